@@ -17,6 +17,7 @@
 
 #include <usbd_int.h>
 #include <cdc_acm_core.h>
+#include <scheduler.h>
 
 #define USBD_VID						  0x600D
 #define USBD_PID						  0xC0DE
@@ -272,12 +273,14 @@ uint8_t cdc_acm_data_handler (void *pudev, usb_dir_enum rx_tx, uint8_t ep_num)
 {
 	if ((USB_TX == rx_tx) && ((CDC_ACM_DATA_IN_EP & 0x7F) == ep_num)) {
 		packet_sent = 1;
+		sched_event_post(SCHED_EVENT_USB_TX);
 		return USBD_OK;
 	} else if ((USB_RX == rx_tx) && ((EP0_OUT & 0x7F) == ep_num)) {
 		cdc_acm_EP0_RxReady (pudev);
 	} else if ((USB_RX == rx_tx) && ((CDC_ACM_DATA_OUT_EP & 0x7F) == ep_num)) {
 		packet_receive = 1;
 		receive_length = usbd_rxcount_get(pudev, CDC_ACM_DATA_OUT_EP);
+		sched_event_post(SCHED_EVENT_USB_RX);
 		return USBD_OK;
 	}
 	return USBD_FAIL;
@@ -18,6 +18,7 @@
 #include <gd32f3x0.h>
 #include <string.h>
 #include <leds.h>
+#include <scheduler.h>
 
 void jump_to_app(uint32_t addr, struct bootloader_usb *usb);
 
@@ -143,6 +144,7 @@ void dfu(struct bootloader_usb *usb)
 		if (received_len == 1)
 		{
 			leds_off(); // so no IRQs
+			sched_stop();
 			jump_to_app(FIRMWARE_START_ADDR, usb);
 		}
 
@@ -20,6 +20,7 @@
 #include <bootloader.h>
 #include <dfu.h>
 #include <leds.h>
+#include <scheduler.h>
 
 void jump_to_app(uint32_t addr, struct bootloader_usb *usb);
 
@@ -44,7 +45,10 @@ int usb_receive_data()
 {
 	receive_length = 0;
 	cdc_acm_data_receive(&usbfs_core_dev);
-	while (!packet_receive);
+
+	// Sleep until the endpoint interrupt posts the completion, the flag says whether it was ours
+	while (!packet_receive)
+		sched_event_wait(SCHED_EVENT_MASK(SCHED_EVENT_USB_RX), SCHED_EVENT_SLICE_US);
 	return receive_length;
 }
 
@@ -52,7 +56,8 @@ void usb_send_data(int len)
 {
 	packet_sent = 0;
 	cdc_acm_data_send(&usbfs_core_dev, len);
-	while (!packet_sent);
+	while (!packet_sent)
+		sched_event_wait(SCHED_EVENT_MASK(SCHED_EVENT_USB_TX), SCHED_EVENT_SLICE_US);
 
 	// We need to send a ZLP to signal end of bulk in case the data length is multiple of max packet size
 	// Due our buffer size is 64 this only happens in the case we send 64 bytes.
@@ -101,6 +106,7 @@ int main(void)
 
 	if (SET == usb_power)
 	{
+		sched_init();
 		leds_init();
 		delay_init();
 		leds_set_pattern(&lp_usb);
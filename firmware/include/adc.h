@@ -24,6 +24,19 @@
 void adc_init(uint32_t gpio_periph, uint32_t pin, uint8_t channel);
 
 uint16_t adc_wait_eoc_read();
+void adc_select_channel(uint32_t gpio_periph, uint32_t pin, uint8_t channel);
+
+// Convert the regular channel continuously and post SCHED_EVENT_ADC_THRESHOLD once it reads
+// below low or above high. adc_wait_eoc_read() can't be used until adc_watch_stop().
+void adc_watch_start(uint16_t low, uint16_t high);
+void adc_watch_stop();
+
+// Inserted group ranks of the console sense pins
+#define ADC_SCAN_ERISTA	0
+#define ADC_SCAN_MARIKO	1
+#define ADC_SCAN_LITE	2
+void adc_scan_init();
+void adc_scan_read(uint16_t values[3]);
 
 struct adc_param
 {
@@ -31,6 +44,9 @@ struct adc_param
 	uint16_t glitch_threshold; // min ADC value from where we can begin attemping to glitch (~1.2V)
 };
 
+// Power-on threshold of the rail selected by init_device_specific_adc(), 0 until then
+extern uint16_t adc_rail_poweron_threshold;
+
 int init_device_specific_adc(enum DEVICE_TYPE dt, struct adc_param *pap);
 int adc_wait_for_min_value(logger *lgr, unsigned int min_adc_value, uint16_t *adc_read_out);
 
@@ -36,6 +36,7 @@ typedef struct
 	uint32_t count;
 	timing_t timings[32];
 	uint8_t reflash;
+	uint16_t reset_hold_ms; // learned clock-stuck reset hold, FPGA_RESET_HOLD_UNKNOWN if not learned yet
 } config_t;
 
 void config_clear(config_t *cfg);
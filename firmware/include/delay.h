@@ -19,11 +19,24 @@
 
 #include "gd32f3x0.h"
 
+// Time measured on timer_global_get_us(), the one time base. SysTick wraps are counted by the
+// scheduler tick; without it delay_elapsed_us() has to be called at least every ~170ms.
+typedef struct
+{
+	uint32_t start_us;
+} delay_elapsed_t;
+
 /* initialization time delay function */
 void delay_init();
 /* delay ms function */
 void delay_ms(uint32_t nms);
 /* delay us function */
 void delay_us(uint32_t nus);
+/* start measuring elapsed time */
+void delay_elapsed_start(delay_elapsed_t *elapsed);
+/* us since delay_elapsed_start */
+uint32_t delay_elapsed_us(delay_elapsed_t *elapsed);
+/* sleep until an interrupt or at most max_us */
+void delay_sleep_us(uint32_t max_us);
 
 #endif /* DELAY_H */
@@ -24,6 +24,11 @@ extern int payload_not_yet_flashed;
 
 void fpga_init();
 uint32_t fpga_reset();
+
+// Edges on FPGA_SYNC/FPGA_STATUS are posted as scheduler events, so waits end as soon as the pin moves
+#define FPGA_SYNC_TIMEOUT_US	1000000 // was 100 polls of 10ms
+void fpga_events_init();
+uint32_t fpga_wait_sync(uint32_t timeout_us);
 void fpga_power_off();
 
 enum FPGA_BUFFER
@@ -35,6 +40,17 @@ enum FPGA_BUFFER
 
 void fpga_select_active_buffer(enum FPGA_BUFFER buffer);
 void fpga_reset_device(int do_clock_stuck_glitch);
+
+// The clock-stuck reset is held until the console rail is seen dropping. The time that took is
+// learned and kept with the training config, it bounds the hold when the rail can't be sampled.
+#define FPGA_RESET_HOLD_UNKNOWN	0xFFFF
+#define FPGA_RESET_HOLD_MIN_MS	20
+#define FPGA_RESET_HOLD_MAX_MS	2000 // fixed hold used before anything was learned
+uint16_t fpga_reset_hold_get();
+// Time from releasing the last clock-stuck reset until the rail was back, FPGA_RESET_HOLD_UNKNOWN if not seen
+uint16_t fpga_reset_recovery_get();
+void fpga_reset_hold_saved(uint16_t hold_ms);
+int fpga_reset_hold_changed();
 typedef struct
 {
 	uint16_t offset; // 12-bit counter marking number of eMMC clock cycles to wait after completed sector 0x13 READ_SINGLE_BLOCK command
@@ -45,6 +61,11 @@ typedef struct
 void fpga_glitch_device(glitch_cfg_t *cfg);
 uint8_t fpga_read_glitch_flags();
 
+// While streaming, the flag reads below are served from a RAM copy that DMA refreshes every few
+// microseconds. Any other FPGA transaction stops streaming first.
+void fpga_status_stream_start();
+void fpga_status_stream_stop();
+
 #define FPGA_MMC_BUSY_SENDING           0x01
 #define FPGA_MMC_GLITCH_SUCCESS         0x02
 #define FPGA_MMC_GLITCH_TIMEOUT         0x04
@@ -62,6 +83,7 @@ void fpga_read_buffer(uint8_t *buffer, uint32_t size);
 void fpga_write_buffer(uint8_t *buffer, uint32_t size);
 
 void fpga_enter_cmd_mode();
+#define FPGA_RECV_POLL_US	200
 void fpga_pre_recv();
 void fpga_post_recv();
 void fpga_post_send();
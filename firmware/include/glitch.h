@@ -28,6 +28,7 @@ enum GLITCH_RESULT_TYPE
 	GLITCH_RESULT_FAIL_TIMEOUT,
 	GLITCH_RESULT_FAILED_MMC,
 	GLITCH_RESULT_SUCCESS,
+	GLITCH_RESULT_FAILED_GARBLED, // eMMC traffic with bad CRCs or R1 errors, no hang
 };
 
 enum STATUSCODE glitch(logger *lgr, session_info_t *session_info, bool is_training);
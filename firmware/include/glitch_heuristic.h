@@ -30,6 +30,10 @@ typedef struct
 
 } glitch_heuristic_t;
 
+// Labels an attempt from the FPGA flags and the sniffed eMMC traffic. Hardware independent,
+// so recorded attempts can be replayed through it on the host.
+enum GLITCH_RESULT_TYPE glitch_classify(uint8_t mmc_flags, uint8_t *data, int datalen);
+
 void heuristic_add_result(glitch_heuristic_t *heuristic, enum GLITCH_RESULT_TYPE result);
 void heuristic_advice(glitch_heuristic_t *heuristic, bool *fatal_abort, bool *try_next_offset, int *width_adjust, int *offset_adjust);
 
@@ -18,6 +18,7 @@
 #define __LEDS_H__
 
 #include <stdint.h>
+#include <stdbool.h>
 
 enum led_pattern_type
 {
@@ -33,6 +34,13 @@ typedef struct
 	uint8_t blue;
 } led_pattern_t;
 
+// One step of a sequence, shown for duration_ms (0 = until changed)
+typedef struct
+{
+	led_pattern_t pattern;
+	uint16_t duration_ms;
+} led_step_t;
+
 void leds_init();
 
 led_pattern_t leds_get_pattern();
@@ -41,36 +49,41 @@ void leds_set_pattern(const led_pattern_t *pattern);
 // Update led pattern, but wait delay_ms first. Calls to leds_set_pattern cancel delayed changes.
 void leds_set_pattern_delayed(const led_pattern_t *pattern, int delay_ms);
 
+// Play count steps in order, starting over after the last one if loop is set.
+// steps must stay valid while playing. leds_set_pattern and leds_set_pattern_delayed stop it.
+void leds_play_sequence(const led_step_t *steps, uint8_t count, bool loop);
+
 // Override led_pattern with supplied one for given duration.
 // Led can only be changed immediately with another call to leds_override.
 // Other changes are enqueued and applied once duration_ms expires.
 void leds_override(uint32_t duration_ms, const led_pattern_t *pattern);
 
 // Turn leds fully off. Requires another call to leds_init() before they can be used again.
+// The scheduler tick keeps running, see sched_stop().
 void leds_off();
 
-extern led_pattern_t lp_train_prepare;
-extern led_pattern_t lp_train_glitching;
-extern led_pattern_t lp_train_done;
+extern const led_pattern_t lp_train_prepare;
+extern const led_pattern_t lp_train_glitching;
+extern const led_pattern_t lp_train_done;
 
-extern led_pattern_t lp_glitch_prepare;
-extern led_pattern_t lp_glitch_glitching;
-extern led_pattern_t lp_glitch_done;
-extern led_pattern_t lp_flash_payload;
+extern const led_pattern_t lp_glitch_prepare;
+extern const led_pattern_t lp_glitch_glitching;
+extern const led_pattern_t lp_glitch_done;
+extern const led_pattern_t lp_flash_payload;
 
-extern led_pattern_t lp_usb;
-extern led_pattern_t lp_toolbox;
-extern led_pattern_t lp_fw_write;
-extern led_pattern_t lp_fw_read;
+extern const led_pattern_t lp_usb;
+extern const led_pattern_t lp_toolbox;
+extern const led_pattern_t lp_fw_write;
+extern const led_pattern_t lp_fw_read;
 
-extern led_pattern_t lp_err_emmc;
-extern led_pattern_t lp_err_exhausted;
-extern led_pattern_t lp_err_adc;
-extern led_pattern_t lp_err_fpga;
-extern led_pattern_t lp_err_glitch;
-extern led_pattern_t lp_err_firmware;
-extern led_pattern_t lp_err_unknown;
-extern led_pattern_t lp_config_reset;
-extern led_pattern_t lp_off;
+extern const led_pattern_t lp_err_emmc;
+extern const led_pattern_t lp_err_exhausted;
+extern const led_pattern_t lp_err_adc;
+extern const led_pattern_t lp_err_fpga;
+extern const led_pattern_t lp_err_glitch;
+extern const led_pattern_t lp_err_firmware;
+extern const led_pattern_t lp_err_unknown;
+extern const led_pattern_t lp_config_reset;
+extern const led_pattern_t lp_off;
 
 #endif
\ No newline at end of file
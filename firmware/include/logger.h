@@ -17,6 +17,7 @@
 #ifndef __LOGGER_H__
 #define __LOGGER_H__
 
+#include <stdbool.h>
 #include <config.h>
 #include <device.h>
 
@@ -31,6 +32,7 @@ typedef struct
 	void (*end)();
 	void (*adc)(uint32_t value);
 	void (*stats)(uint32_t attempt, uint16_t offset, uint8_t width, uint8_t subcycle, uint8_t needs_reflash);
+	bool wants_glitch_data; // capture eMMC traffic even when the result doesn't depend on it
 } logger;
 
 extern logger null_logger;
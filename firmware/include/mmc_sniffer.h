@@ -19,13 +19,15 @@
 #define __MMC_SNIFFER_H__
 
 #include <stdint.h>
+#include <stdbool.h>
 
 enum MMC_SNIFFER_PACKET_TYPE
 {
-	MMC_SNIFF_PKT_TYPE_INVALID = 0,
+	MMC_SNIFF_PKT_TYPE_INVALID = 0, // end of capture
 	MMC_SNIFF_PKT_TYPE_COMMAND, // 48-bit command from host to device
 	MMC_SNIFF_PKT_TYPE_RESPONSE48, // 48-bit response from device
 	MMC_SNIFF_PKT_TYPE_RESPONSE136, // 136-bit response from device
+	MMC_SNIFF_PKT_TYPE_PARTIAL, // frame cut off by the end of the capture
 };
 
 typedef struct
@@ -33,9 +35,34 @@ typedef struct
 	uint8_t *data;
 	uint32_t datalen;
 	uint8_t cmd;
+	uint32_t arg; // command argument, or card status / OCR of a 48-bit response
+	bool crc_ok; // always true for R3, which carries no CRC
 } mmc_sniff_parser_ctx;
 
 void mmc_sniff_parser_init(mmc_sniff_parser_ctx *ctx, uint8_t *data, int datalen);
 enum MMC_SNIFFER_PACKET_TYPE mmc_sniff_parser_parse(mmc_sniff_parser_ctx *ctx);
 
-#endif
\ No newline at end of file
+// What the eMMC traffic after a glitch attempt says about it, from weakest to strongest evidence
+enum MMC_SNIFF_OUTCOME
+{
+	MMC_SNIFF_OUTCOME_NO_COMMS = 0, // next to nothing on the bus
+	MMC_SNIFF_OUTCOME_HANG, // traffic stopped without a telling command
+	MMC_SNIFF_OUTCOME_GARBLED, // bad CRCs or R1 errors: the SoC misbehaved but kept running
+	MMC_SNIFF_OUTCOME_CONTINUED, // boot read on (CMD17) or restarted the eMMC (CMD0)
+};
+
+typedef struct
+{
+	enum MMC_SNIFF_OUTCOME outcome;
+	uint16_t packets;
+	uint16_t crc_errors;
+	bool partial;
+	uint32_t r1_errors; // R1 error bits seen in any response
+	uint32_t last_read_sector; // argument of the last valid CMD17, 0xFFFFFFFF if none
+} mmc_sniff_summary;
+
+void mmc_sniff_summarize(uint8_t *data, int datalen, mmc_sniff_summary *summary);
+
+int crc7(const uint8_t *buffer, int size);
+
+#endif
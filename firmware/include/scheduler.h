@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2022 HWFLY-NX
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __SCHEDULER_H__
+#define __SCHEDULER_H__
+
+#include <stdint.h>
+
+// Scheduler tick is 1.024KHz, close enough to 1ms for LEDs and timeouts
+#define SCHED_TICK_HZ 1024
+
+typedef void (*sched_fn_t)(void *arg);
+
+typedef struct sched_timer
+{
+	struct sched_timer *next;
+	uint32_t expires;
+	uint16_t period;
+	volatile uint8_t active;
+	sched_fn_t fn;
+	void *arg;
+} sched_timer_t;
+
+// Start the tick. Timers can be armed before, they just won't fire until then.
+void sched_init();
+
+// Stop the tick, armed timers stay armed.
+void sched_stop();
+
+uint32_t sched_get_ticks();
+
+// Arm t to call fn(arg) after delay ticks, then every period ticks (0 = once).
+// Re-arming an armed timer restarts it. Callbacks run in the tick interrupt and
+// must be short; fn may be NULL for timers that are only checked through t->active.
+void sched_timer_start(sched_timer_t *t, uint32_t delay, uint16_t period, sched_fn_t fn, void *arg);
+void sched_timer_stop(sched_timer_t *t);
+
+// Events are posted from interrupts and picked up by the code waiting for them. Posting
+// doesn't need the tick. Like the EXTI flags they come from, pending events coalesce.
+enum SCHED_EVENT
+{
+	SCHED_EVENT_FPGA_STATUS = 0, // edge on FPGA_STATUS
+	SCHED_EVENT_FPGA_SYNC, // rising edge on FPGA_SYNC
+	SCHED_EVENT_ADC_THRESHOLD, // the ADC watch armed by adc_watch_start() tripped
+	SCHED_EVENT_USB_RX, // a CDC ACM OUT transfer completed (bootloader USB stack)
+	SCHED_EVENT_USB_TX, // a CDC ACM IN transfer completed (bootloader USB stack)
+	SCHED_EVENT_COUNT,
+};
+#define SCHED_EVENT_MASK(ev) (1u << (ev))
+
+void sched_event_post(enum SCHED_EVENT ev);
+void sched_event_clear(uint32_t mask);
+
+// Returns and clears the pending events in mask.
+uint32_t sched_event_take(uint32_t mask);
+
+// Sleeps until an event in mask is pending, then returns and clears those events. Returns 0
+// after timeout_us. The core naps in slices of at most SCHED_EVENT_SLICE_US, so callers that
+// also watch a pin without an interrupt see it change within that time.
+#define SCHED_EVENT_SLICE_US 1000
+uint32_t sched_event_wait(uint32_t mask, uint32_t timeout_us);
+
+#endif
@@ -35,6 +35,7 @@ enum STATUSCODE
 	ERR_FLASH_WRITE_FAIL = 0xBAD0010A,
 	ERR_FLASH_PAYLOAD_FAIL = 0xBAD0010C,
 	ERR_FPGA_STATUS_FAIL = 0xBAD00004,
+	ERR_FPGA_SYNC_TIMEOUT = 0xBAD00005,
 	OK_FLASH_SUCCESS = 0x900D0008,
 
 	OK_FPGA_RESET = 0x900D0000,
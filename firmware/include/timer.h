@@ -3,6 +3,8 @@
 
 #include <stdint.h>
 
+// Counts a SysTick wrap if one happened, from the SysTick interrupt or the scheduler tick
+void SysTick_Handler_cnt();
 void timer_global_init();
 void timer2_init();
 uint32_t timer_global_get_us();
@@ -16,10 +16,14 @@
 
 #include <gd32f3x0.h>
 #include <adc.h>
+#include <board.h>
 #include <fpga.h>
 #include <delay.h>
+#include <scheduler.h>
 #include <statuscode.h>
 
+uint16_t adc_rail_poweron_threshold;
+
 void adc_init(uint32_t gpio_periph, uint32_t pin, uint8_t channel)
 {
 	adc_deinit();
@@ -38,38 +42,134 @@ void adc_init(uint32_t gpio_periph, uint32_t pin, uint8_t channel)
 	adc_software_trigger_enable(1);
 	adc_enable();
 	adc_calibration_enable();
+
+	// Only used to wake adc_wait_eoc_read() from WFE, the interrupt stays disabled in the NVIC
+	adc_interrupt_enable(ADC_INT_EOC);
 }
 
 uint16_t adc_wait_eoc_read()
 {
+	NVIC_ClearPendingIRQ(ADC_CMP_IRQn);
 	ADC_CTL1 |= (uint32_t)ADC_CTL1_ADCON;
 
-	while (!(ADC_STAT & ADC_STAT_EOC));
+	while (!(ADC_STAT & ADC_STAT_EOC))
+		__WFE();
 
 	return adc_regular_data_read();
 }
 
+void adc_watch_start(uint16_t low, uint16_t high)
+{
+	// EOC would keep the shared interrupt pending, only the watchdog may raise it meanwhile
+	adc_interrupt_disable(ADC_INT_EOC);
+	adc_watchdog_threshold_config(low, high);
+	adc_watchdog_group_channel_enable(ADC_REGULAR_CHANNEL);
+	adc_interrupt_flag_clear(ADC_INT_FLAG_WDE);
+	sched_event_clear(SCHED_EVENT_MASK(SCHED_EVENT_ADC_THRESHOLD));
+	NVIC_ClearPendingIRQ(ADC_CMP_IRQn);
+	adc_interrupt_enable(ADC_INT_WDE);
+	nvic_irq_enable(ADC_CMP_IRQn, 1, 0);
+
+	adc_special_function_config(ADC_CONTINUOUS_MODE, ENABLE);
+	ADC_CTL1 |= (uint32_t)ADC_CTL1_ADCON;
+}
+
+void adc_watch_stop()
+{
+	adc_special_function_config(ADC_CONTINUOUS_MODE, DISABLE);
+	adc_interrupt_disable(ADC_INT_WDE);
+	nvic_irq_disable(ADC_CMP_IRQn);
+	adc_watchdog_disable();
+
+	// Let the conversion in flight land (a few us), its EOC mustn't end the next adc_wait_eoc_read() early
+	delay_us(10);
+	adc_flag_clear(ADC_FLAG_WDE | ADC_FLAG_EOC);
+	NVIC_ClearPendingIRQ(ADC_CMP_IRQn);
+	adc_interrupt_enable(ADC_INT_EOC);
+}
+
+void ADC_CMP_IRQHandler()
+{
+	if (adc_interrupt_flag_get(ADC_INT_FLAG_WDE))
+	{
+		// One shot, the level stays out of range for a while
+		adc_interrupt_disable(ADC_INT_WDE);
+		adc_interrupt_flag_clear(ADC_INT_FLAG_WDE);
+		sched_event_post(SCHED_EVENT_ADC_THRESHOLD);
+	}
+}
+
+void adc_select_channel(uint32_t gpio_periph, uint32_t pin, uint8_t channel)
+{
+	// Switch the regular conversion over, keeping the calibration of the running ADC
+	gpio_mode_set(gpio_periph, 3, 0, pin);
+	adc_regular_channel_config(0, channel, 0);
+}
+
+void adc_scan_init()
+{
+	if (!(ADC_CTL1 & ADC_CTL1_ADCON))
+		adc_init(CONSOLE_STATE_ADC_PORT, CONSOLE_STATE_ADC_PIN, 3);
+
+	// The inserted group converts all sense pins in one go, leaving the regular channel alone
+	gpio_mode_set(SWITCH_ERISTA_ADC_GPIO_PORT, 3, 0, SWITCH_ERISTA_ADC_GPIO_PIN);
+	gpio_mode_set(SWITCH_MARIKO_ADC_GPIO_PORT, 3, 0, SWITCH_MARIKO_ADC_GPIO_PIN);
+	gpio_mode_set(SWITCH_LITE_ADC_GPIO_PORT, 3, 0, SWITCH_LITE_ADC_GPIO_PIN);
+	adc_channel_length_config(ADC_INSERTED_CHANNEL, 3);
+	adc_inserted_channel_config(ADC_SCAN_ERISTA, 8, 0);
+	adc_inserted_channel_config(ADC_SCAN_MARIKO, 9, 0);
+	adc_inserted_channel_config(ADC_SCAN_LITE, 2, 0);
+	adc_external_trigger_source_config(ADC_INSERTED_CHANNEL, ADC_EXTTRIG_INSERTED_NONE);
+	adc_external_trigger_config(ADC_INSERTED_CHANNEL, ENABLE);
+	adc_special_function_config(ADC_SCAN_MODE, ENABLE);
+}
+
+void adc_scan_read(uint16_t values[3])
+{
+	// Wake from WFE on the end of the group only, EOC would already be pending after the first channel
+	adc_interrupt_disable(ADC_INT_EOC);
+	adc_flag_clear(ADC_FLAG_EOIC | ADC_FLAG_EOC);
+	NVIC_ClearPendingIRQ(ADC_CMP_IRQn);
+	adc_interrupt_enable(ADC_INT_EOIC);
+	adc_software_trigger_enable(ADC_INSERTED_CHANNEL);
+
+	while (!adc_flag_get(ADC_FLAG_EOIC))
+		__WFE();
+
+	for (int i = 0; i < 3; i++)
+		values[i] = adc_inserted_data_read(i);
+
+	// EOC is raised for inserted conversions too, don't let adc_wait_eoc_read() see it
+	adc_interrupt_disable(ADC_INT_EOIC);
+	adc_flag_clear(ADC_FLAG_EOIC | ADC_FLAG_EOC);
+	NVIC_ClearPendingIRQ(ADC_CMP_IRQn);
+	adc_interrupt_enable(ADC_INT_EOC);
+}
+
 int init_device_specific_adc(enum DEVICE_TYPE dt, struct adc_param *pap)
 {
 	if (dt == DEVICE_TYPE_ERISTA)
 	{
-		adc_init(GPIOB, GPIO_PIN_0, 8);
+		adc_select_channel(SWITCH_ERISTA_ADC_GPIO_PORT, SWITCH_ERISTA_ADC_GPIO_PIN, 8);
 		pap->poweron_threshold = 1200;
 		pap->glitch_threshold = 1376;
+		adc_rail_poweron_threshold = pap->poweron_threshold;
 		return 0;
 	}
 	if (dt == DEVICE_TYPE_MARIKO)
 	{
-		adc_init(GPIOB, GPIO_PIN_1, 9);
+		adc_select_channel(SWITCH_MARIKO_ADC_GPIO_PORT, SWITCH_MARIKO_ADC_GPIO_PIN, 9);
 		pap->poweron_threshold = 1024;
 		pap->glitch_threshold = 1296;
+		adc_rail_poweron_threshold = pap->poweron_threshold;
 		return 0;
 	}
 	if (dt == DEVICE_TYPE_LITE)
 	{
-		adc_init(GPIOA, GPIO_PIN_2, 2);
+		adc_select_channel(SWITCH_LITE_ADC_GPIO_PORT, SWITCH_LITE_ADC_GPIO_PIN, 2);
 		pap->poweron_threshold = 1024;
 		pap->glitch_threshold = 1270;
+		adc_rail_poweron_threshold = pap->poweron_threshold;
 		return 0;
 	}
 	return ERR_UNKNOWN_DEVICE;
@@ -28,8 +28,14 @@ void clocks_init()
 	// FPGA
 	rcu_periph_clock_enable(RCU_SPI0);
 
+	// FPGA status streaming
+	rcu_periph_clock_enable(RCU_DMA);
+
 	// FPGA Sync
 	rcu_periph_clock_enable(RCU_GPIOF);
+
+	// FPGA Sync/Status edge detection (EXTI line mapping)
+	rcu_periph_clock_enable(RCU_CFGCMP);
 }
 
 void clock_output_init()
@@ -24,6 +24,7 @@ void config_clear(config_t *cfg)
 	memset(cfg->timings, 0xFF, sizeof(cfg->timings));
 	cfg->magic = 0;
 	cfg->count = 0;
+	cfg->reset_hold_ms = FPGA_RESET_HOLD_UNKNOWN;
 }
 
 enum STATUSCODE config_load(config_t *cfg)
@@ -110,6 +111,7 @@ char burn_flash(uint8_t *dest, uint8_t *src, uint32_t len)
 enum STATUSCODE config_save(config_t *cfg)
 {
 	cfg->magic = CONFIG_MAGIC;
+	cfg->reset_hold_ms = fpga_reset_hold_get();
 
 	for (int i = 0; i < cfg->count; i++)
 	{
@@ -130,6 +132,8 @@ enum STATUSCODE config_save(config_t *cfg)
 	if (!burn_flash((uint8_t *) 0x801FC00, (uint8_t *) cfg, sizeof(config_t)))
 		return ERR_FLASH_WRITE_FAIL;
 
+	fpga_reset_hold_saved(cfg->reset_hold_ms);
+
 	return OK_CONFIG;
 }
 
@@ -25,6 +25,7 @@
 #include <clock.h>
 #include <payload.h>
 #include <timer.h>
+#include <scheduler.h>
 #include <sdio.h>
 #include <statuscode.h>
 #include <string.h>
@@ -110,8 +111,23 @@ void dbg_logger_new_config_and_save(glitch_cfg_t *new_cfg, int save_ret)
 	dbglog("new cfg: [%d, %d.%d] save res: %x\r\n", new_cfg->offset, new_cfg->width, new_cfg->subcycle_delay, save_ret);
 }
 
+// Recorder mode: glitch results are printed as GLITCH_RECORD_TAG lines, one per attempt:
+// "@GR1 <offset> <width> <subcycle> <mmc_flags> <glitch_flags> <result> <datalen> <data>", flags and data in hex.
+// A capture of these is a corpus for the host replay tool in tools/glitch_replay.c.
+#define GLITCH_RECORD_TAG "@GR1"
+static bool g_dbg_record;
+
 void dbg_logger_glitch_result(glitch_cfg_t *new_cfg, uint8_t glitch_res, uint8_t mmc_flags, unsigned int datalen, uint8_t *data, uint8_t glitch_flags)
 {
+	if (g_dbg_record)
+	{
+		dbglog(GLITCH_RECORD_TAG " %d %d %d %02X %02X %d %d ", new_cfg->offset, new_cfg->width, new_cfg->subcycle_delay, mmc_flags, glitch_flags, glitch_res, datalen);
+		for (int i = 0; i < datalen; ++i)
+			dbglog("%02X", data[i]);
+		dbglog("\r\n");
+		return;
+	}
+
 	dbglog("glitch info: [%d, %d, %d] {%d} %x %x ", new_cfg->offset, new_cfg->width, new_cfg->subcycle_delay, glitch_res, mmc_flags, glitch_flags);
 	for (int i = 0; i < datalen; ++i)
 	{
@@ -145,7 +161,8 @@ logger dbg_logger =
 	dbg_logger_glitch_result,
 	dbg_logger_end,
 	dbg_logger_adc,
-	dbg_logger_stats
+	dbg_logger_stats,
+	true
 };
 
 int wait_for_power_on(enum DEVICE_TYPE *pdt)
@@ -185,9 +202,11 @@ int reset_device_and_wait_for_power_on()
 void debug_led_blink_success()
 {
 	// Green for 2s, then back to USB indicator
-	led_pattern_t green = {solid, 0x00, 0xFF, 0x00};
-	leds_set_pattern(&green);
-	leds_set_pattern_delayed(&lp_usb, 2000);
+	static const led_step_t success[] = {
+		{{solid, 0x00, 0xFF, 0x00}, 2000},
+		{{pulse, 0x00, 0x00, 0x3F}, 0}, // lp_usb
+	};
+	leds_play_sequence(success, 2, false);
 }
 
 void debug_main(struct bootloader_usb *usb)
@@ -198,6 +217,7 @@ void debug_main(struct bootloader_usb *usb)
 	clocks_init();
 	timer_global_init();
 	leds_set_pattern(&lp_usb);
+	sched_init();
 	leds_init();
 	clock_output_init();
 	fpga_init();
@@ -400,6 +420,8 @@ void debug_main(struct bootloader_usb *usb)
 					dbglog("# Config count: %d\r\n", cfg.count);
 					for (int i = 0; i < cfg.count; ++i)
 						dbglog("# %02d: [%d, %d] %d\r\n", i, cfg.timings[i].offset, cfg.timings[i].width, cfg.timings[i].success);
+					dbglog("# Reset hold: %d ms\r\n", cfg.reset_hold_ms);
+					dbglog("# Last reset recovery: %d ms\r\n", fpga_reset_recovery_get());
 				}
 				break;
 			}
@@ -434,6 +456,12 @@ void debug_main(struct bootloader_usb *usb)
 				(*application)(usb);
 				break;
 			}
+			case 'g':
+			{
+				g_dbg_record = !g_dbg_record;
+				dbglog("# Glitch result recorder %s\r\n", g_dbg_record ? "on" : "off");
+				break;
+			}
 			case 'h':
 			{
 				dbglog("# Debug menu keys overview\r\n");
@@ -446,6 +474,7 @@ void debug_main(struct bootloader_usb *usb)
 				dbglog("   'r'  Reset timing configuration table\r\n");
 				dbglog("   'p'  Program eMMC with embedded payload\r\n");
 				dbglog("   'e'  Erase eMMC BOOT0 payload\r\n");
+				dbglog("   'g'  Toggle glitch result recorder\r\n");
 				dbglog("   'x'  Jump to bootloader\r\n");
 				dbglog("   'h'  Show this help text\r\n");
 				dbglog("# ========================\r\n");
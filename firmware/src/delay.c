@@ -16,12 +16,51 @@
 
 #include <gd32f3x0.h>
 #include <delay.h>
+#include <timer.h>
+
+// One-shot 1MHz timer whose update only wakes the core out of WFE. Its interrupt is never
+// enabled in the NVIC, SEVONPEND turns the pending bit into a wakeup event.
+#define WAKEUP_TIMER		TIMER5
+#define WAKEUP_TIMER_IRQn	TIMER5_DAC_IRQn
+
+// Waits shorter than this spin, the tail of longer ones too so they stay cycle accurate
+#define DELAY_SLEEP_SLACK_US	10
 
 void delay_init()
 {
 	SysTick->LOAD = 0xFFFFFF;
 	SysTick->VAL = 0;
 	SysTick->CTRL = 5;
+
+	rcu_periph_clock_enable(RCU_TIMER5);
+	timer_deinit(WAKEUP_TIMER);
+	timer_parameter_struct initpara;
+	timer_struct_para_init(&initpara);
+	initpara.prescaler = 95; // 1us
+	initpara.period = 0xFFFF;
+	timer_init(WAKEUP_TIMER, &initpara);
+	timer_single_pulse_mode_config(WAKEUP_TIMER, TIMER_SP_MODE_SINGLE);
+	timer_interrupt_enable(WAKEUP_TIMER, TIMER_INT_UP);
+
+	SCB->SCR |= SCB_SCR_SEVONPEND_Msk;
+}
+
+void delay_sleep_us(uint32_t max_us)
+{
+	if (max_us == 0)
+		return;
+	if (max_us > 0xFFFF)
+		max_us = 0xFFFF;
+
+	timer_autoreload_value_config(WAKEUP_TIMER, max_us);
+	timer_counter_value_config(WAKEUP_TIMER, 0);
+	timer_interrupt_flag_clear(WAKEUP_TIMER, TIMER_INT_FLAG_UP);
+	NVIC_ClearPendingIRQ(WAKEUP_TIMER_IRQn);
+	timer_enable(WAKEUP_TIMER);
+
+	// Any interrupt ends the nap early as well, callers re-check their condition
+	__WFE();
+	timer_disable(WAKEUP_TIMER);
 }
 
 void SysTick_delay(uint64_t val)
@@ -35,6 +74,9 @@ void SysTick_delay(uint64_t val)
 			break;
 		val -= diff;
 		i = new_val;
+
+		if (val >= 2 * DELAY_SLEEP_SLACK_US * 96)
+			delay_sleep_us(val / 96 - DELAY_SLEEP_SLACK_US);
 	}
 }
 
@@ -47,3 +89,13 @@ void delay_us(uint32_t nus)
 {
 	SysTick_delay((uint64_t)96 * (uint64_t)nus);
 }
+
+void delay_elapsed_start(delay_elapsed_t *elapsed)
+{
+	elapsed->start_us = timer_global_get_us();
+}
+
+uint32_t delay_elapsed_us(delay_elapsed_t *elapsed)
+{
+	return timer_global_get_us() - elapsed->start_us;
+}
@@ -24,24 +24,20 @@
 
 enum DEVICE_TYPE detect_device_type()
 {
-	fpga_reset_device(0);
-	delay_ms(1);
+	uint16_t values[3];
+	adc_scan_init();
+	adc_scan_read(values);
+
 	enum BOARD_ID bid = board_id_get();
 	if (bid == BOARD_ID_LITE)
 	{
-		adc_init(SWITCH_LITE_ADC_GPIO_PORT, SWITCH_LITE_ADC_GPIO_PIN, 2);
-		if (adc_wait_eoc_read() > 0xFF)
+		if (values[ADC_SCAN_LITE] > 0xFF)
 			return DEVICE_TYPE_LITE;
 	}
 	else if (bid == BOARD_ID_CORE)
 	{
-		adc_init(SWITCH_MARIKO_ADC_GPIO_PORT, SWITCH_MARIKO_ADC_GPIO_PIN, 9);
-		int bp1_val = adc_wait_eoc_read();
-		gpio_mode_set(SWITCH_MARIKO_ADC_GPIO_PORT, GPIO_MODE_INPUT, GPIO_PUPD_NONE, SWITCH_MARIKO_ADC_GPIO_PIN);
-
-		adc_init(SWITCH_ERISTA_ADC_GPIO_PIN, SWITCH_ERISTA_ADC_GPIO_PORT, 8);
-		int bp0_val = adc_wait_eoc_read();
-		gpio_mode_set(SWITCH_ERISTA_ADC_GPIO_PIN, GPIO_MODE_INPUT, GPIO_PUPD_NONE, SWITCH_ERISTA_ADC_GPIO_PORT);
+		int bp1_val = values[ADC_SCAN_MARIKO];
+		int bp0_val = values[ADC_SCAN_ERISTA];
 
 		if (bp1_val > 255 && bp0_val <= 256)
 				return DEVICE_TYPE_MARIKO;
@@ -49,4 +45,4 @@ enum DEVICE_TYPE detect_device_type()
 				return DEVICE_TYPE_ERISTA;
 	}
 	return DEVICE_TYPE_UNKNOWN;
-}
\ No newline at end of file
+}
@@ -16,8 +16,11 @@
 
 #include <gd32f3x0.h>
 #include <fpga.h>
+#include <adc.h>
+#include <config.h>
 #include <board.h>
 #include <delay.h>
+#include <scheduler.h>
 #include <statuscode.h>
 #include <string.h>
 
@@ -25,6 +28,37 @@ int fpga_sync_failed = 1;
 
 int payload_not_yet_flashed = 1;
 
+// FPGA_STATUS has to stay high for this long after its last edge to count as configured
+#define FPGA_STATUS_SETTLE_US	5000
+// Upper bound, matches the old fixed delay
+#define FPGA_STATUS_TIMEOUT_US	50000
+
+// A status pair takes a few microseconds, this only catches a DMA that never completes
+#define FPGA_STATUS_STREAM_TIMEOUT_US	1000
+
+// Kept after the rail dropped, and added on top of the learned drop time
+#define FPGA_RESET_HOLD_MARGIN_MS	20
+
+static uint16_t fpga_reset_hold_ms = FPGA_RESET_HOLD_UNKNOWN;
+static uint16_t fpga_reset_hold_flash_ms = FPGA_RESET_HOLD_UNKNOWN;
+static int fpga_reset_hold_loaded;
+static uint16_t fpga_reset_recovery_ms = FPGA_RESET_HOLD_UNKNOWN;
+
+// Status streaming: DMA reads the glitch and MMC flags back to back into RAM
+enum
+{
+	FPGA_STATUS_GLITCH = 0,
+	FPGA_STATUS_MMC = 1,
+};
+static const uint8_t fpga_status_cmd[2][3] = {{0x26, 0xA, 0}, {0x26, 0xB, 0}};
+static uint8_t fpga_status_rx[3];
+static volatile uint8_t fpga_status_mirror[2];
+static volatile uint32_t fpga_status_seq;
+static volatile int fpga_status_streaming;
+static volatile int fpga_status_busy;
+static int fpga_status_slot;
+
+
 void fpga_init_spi(int prescale)
 {
 	spi_parameter_struct spi_struct;
@@ -41,6 +75,127 @@ void fpga_init_spi(int prescale)
 	spi_enable(SPI0);
 }
 
+static void fpga_status_stream_init()
+{
+	dma_parameter_struct dma;
+	dma_struct_para_init(&dma);
+	dma.periph_addr = (uint32_t)&SPI_DATA(SPI0);
+	dma.periph_width = DMA_PERIPHERAL_WIDTH_8BIT;
+	dma.periph_inc = DMA_PERIPH_INCREASE_DISABLE;
+	dma.memory_width = DMA_MEMORY_WIDTH_8BIT;
+	dma.memory_inc = DMA_MEMORY_INCREASE_ENABLE;
+	dma.number = sizeof(fpga_status_rx);
+	dma.priority = DMA_PRIORITY_HIGH;
+
+	dma_deinit(DMA_CH1);
+	dma.memory_addr = (uint32_t)fpga_status_rx;
+	dma.direction = DMA_PERIPHERAL_TO_MEMORY;
+	dma_init(DMA_CH1, &dma);
+	dma_interrupt_enable(DMA_CH1, DMA_INT_FTF);
+
+	dma_deinit(DMA_CH2);
+	dma.memory_addr = (uint32_t)fpga_status_cmd[0];
+	dma.direction = DMA_MEMORY_TO_PERIPHERAL;
+	dma_init(DMA_CH2, &dma);
+
+	nvic_irq_enable(DMA_Channel1_2_IRQn, 0, 0);
+}
+
+static void fpga_status_stream_kick()
+{
+	dma_channel_disable(DMA_CH1);
+	dma_channel_disable(DMA_CH2);
+	dma_memory_address_config(DMA_CH2, (uint32_t)fpga_status_cmd[fpga_status_slot]);
+	dma_transfer_number_config(DMA_CH1, sizeof(fpga_status_rx));
+	dma_transfer_number_config(DMA_CH2, sizeof(fpga_status_rx));
+
+	gpio_bit_reset(FPGA_CS_GPIO_PORT, FPGA_CS_GPIO_PIN);
+	dma_channel_enable(DMA_CH1);
+	dma_channel_enable(DMA_CH2);
+}
+
+void DMA_Channel1_2_IRQHandler()
+{
+	if (dma_interrupt_flag_get(DMA_CH1, DMA_INT_FLAG_FTF) == SET)
+	{
+		dma_interrupt_flag_clear(DMA_CH1, DMA_INT_FLAG_G);
+		dma_flag_clear(DMA_CH2, DMA_FLAG_G);
+
+		// The last byte is in, so the transaction is over
+		gpio_bit_set(FPGA_CS_GPIO_PORT, FPGA_CS_GPIO_PIN);
+		fpga_status_mirror[fpga_status_slot] = fpga_status_rx[2];
+		if (fpga_status_slot == FPGA_STATUS_MMC)
+			fpga_status_seq++;
+		fpga_status_slot ^= 1;
+
+		if (fpga_status_streaming)
+			fpga_status_stream_kick();
+		else
+			fpga_status_busy = 0;
+	}
+}
+
+// DMA never completed: stop it and leave streaming off, so the flag reads go over SPI again
+static void fpga_status_stream_abort()
+{
+	nvic_irq_disable(DMA_Channel1_2_IRQn);
+	fpga_status_streaming = 0;
+	fpga_status_busy = 0;
+	dma_channel_disable(DMA_CH1);
+	dma_channel_disable(DMA_CH2);
+	gpio_bit_set(FPGA_CS_GPIO_PORT, FPGA_CS_GPIO_PIN);
+	spi_dma_disable(SPI0, SPI_DMA_TRANSMIT);
+	spi_dma_disable(SPI0, SPI_DMA_RECEIVE);
+	nvic_irq_enable(DMA_Channel1_2_IRQn, 0, 0);
+}
+
+void fpga_status_stream_start()
+{
+	if (fpga_status_streaming)
+		return;
+
+	spi_dma_enable(SPI0, SPI_DMA_RECEIVE);
+	spi_dma_enable(SPI0, SPI_DMA_TRANSMIT);
+	fpga_status_slot = FPGA_STATUS_GLITCH;
+	fpga_status_busy = 1;
+	fpga_status_streaming = 1;
+
+	// Hand out nothing older than the start of streaming
+	uint32_t seq = fpga_status_seq;
+	delay_elapsed_t elapsed;
+	delay_elapsed_start(&elapsed);
+	fpga_status_stream_kick();
+	while (fpga_status_seq == seq)
+	{
+		if (delay_elapsed_us(&elapsed) >= FPGA_STATUS_STREAM_TIMEOUT_US)
+		{
+			fpga_status_stream_abort();
+			return;
+		}
+	}
+}
+
+void fpga_status_stream_stop()
+{
+	if (!fpga_status_streaming)
+		return;
+
+	// The handler finishes the transaction in flight and doesn't start another
+	fpga_status_streaming = 0;
+	delay_elapsed_t elapsed;
+	delay_elapsed_start(&elapsed);
+	while (fpga_status_busy)
+	{
+		if (delay_elapsed_us(&elapsed) >= FPGA_STATUS_STREAM_TIMEOUT_US)
+		{
+			fpga_status_stream_abort();
+			return;
+		}
+	}
+	spi_dma_disable(SPI0, SPI_DMA_TRANSMIT);
+	spi_dma_disable(SPI0, SPI_DMA_RECEIVE);
+}
+
 void fpga_init()
 {
 	fpga_init_spi(SPI_PSC_2);
@@ -63,6 +218,57 @@ void fpga_init()
 	gpio_mode_set(FPGA_STATUS_PORT, GPIO_MODE_INPUT, GPIO_PUPD_PULLUP, FPGA_STATUS_PIN);
 	gpio_mode_set(FPGA_PWR_EN_PORT, GPIO_MODE_OUTPUT, GPIO_PUPD_NONE, FPGA_PWR_EN_PIN);
 	gpio_mode_set(FPGA_CS_GPIO_PORT, GPIO_MODE_OUTPUT, GPIO_PUPD_PULLUP, FPGA_CS_GPIO_PIN);
+	fpga_status_stream_init();
+}
+
+void fpga_events_init()
+{
+	syscfg_exti_line_config(EXTI_SOURCE_GPIOA, EXTI_SOURCE_PIN1);
+	syscfg_exti_line_config(EXTI_SOURCE_GPIOF, EXTI_SOURCE_PIN7);
+	exti_init(EXTI_1, EXTI_INTERRUPT, EXTI_TRIG_BOTH);
+	exti_init(EXTI_7, EXTI_INTERRUPT, EXTI_TRIG_RISING);
+	exti_interrupt_flag_clear(EXTI_1);
+	exti_interrupt_flag_clear(EXTI_7);
+	nvic_irq_enable(EXTI0_1_IRQn, 1, 0);
+	nvic_irq_enable(EXTI4_15_IRQn, 1, 0);
+}
+
+void EXTI0_1_IRQHandler()
+{
+	if (exti_interrupt_flag_get(EXTI_1) == SET)
+	{
+		exti_interrupt_flag_clear(EXTI_1);
+		sched_event_post(SCHED_EVENT_FPGA_STATUS);
+	}
+}
+
+void EXTI4_15_IRQHandler()
+{
+	if (exti_interrupt_flag_get(EXTI_7) == SET)
+	{
+		exti_interrupt_flag_clear(EXTI_7);
+		sched_event_post(SCHED_EVENT_FPGA_SYNC);
+	}
+}
+
+uint32_t fpga_wait_sync(uint32_t timeout_us)
+{
+	// Released (or driven high) by the FPGA once it is ready
+	sched_event_clear(SCHED_EVENT_MASK(SCHED_EVENT_FPGA_SYNC));
+	gpio_mode_set(FPGA_SYNC_PORT, GPIO_MODE_INPUT, GPIO_PUPD_PULLUP, FPGA_SYNC_PIN);
+	delay_us(10); // let the pull-up charge the line
+
+	delay_elapsed_t elapsed;
+	delay_elapsed_start(&elapsed);
+	while (!gpio_input_bit_get(FPGA_SYNC_PORT, FPGA_SYNC_PIN))
+	{
+		if (delay_elapsed_us(&elapsed) >= timeout_us)
+			return ERR_FPGA_SYNC_TIMEOUT;
+		if (sched_event_wait(SCHED_EVENT_MASK(SCHED_EVENT_FPGA_SYNC), SCHED_EVENT_SLICE_US))
+			break;
+	}
+
+	return OK;
 }
 
 void gpioa_set_pin4()
@@ -74,6 +280,8 @@ void gpioa_set_pin4()
 
 void gpioa_clear_pin4()
 {
+	// Any other transaction needs the bus back
+	fpga_status_stream_stop();
 	gpio_bit_reset(FPGA_CS_GPIO_PORT, FPGA_CS_GPIO_PIN);
 }
 
@@ -84,8 +292,23 @@ uint32_t fpga_reset()
 	gpio_bit_reset(FPGA_PWR_EN_PORT, FPGA_PWR_EN_PIN);
 	gpioa_set_pin4();
 	delay_us(300);
+
+	delay_elapsed_t elapsed, settle;
+	sched_event_clear(SCHED_EVENT_MASK(SCHED_EVENT_FPGA_STATUS));
+	delay_elapsed_start(&elapsed);
+	settle = elapsed;
 	gpio_bit_set(FPGA_PWR_EN_PORT, FPGA_PWR_EN_PIN);
-	delay_ms(50);
+
+	// Done once FPGA_STATUS is high and hasn't moved for a while, instead of a fixed 50ms
+	while (delay_elapsed_us(&elapsed) < FPGA_STATUS_TIMEOUT_US)
+	{
+		// Any edge restarts the settle window
+		if (sched_event_wait(SCHED_EVENT_MASK(SCHED_EVENT_FPGA_STATUS), SCHED_EVENT_SLICE_US))
+			delay_elapsed_start(&settle);
+		else if (gpio_input_bit_get(FPGA_STATUS_PORT, FPGA_STATUS_PIN) && delay_elapsed_us(&settle) >= FPGA_STATUS_SETTLE_US)
+			break;
+	}
+
 	if (!gpio_input_bit_get(FPGA_STATUS_PORT, FPGA_STATUS_PIN))
 		return ERR_FPGA_STATUS_FAIL;
 
@@ -167,6 +390,121 @@ void fpga_select_active_buffer(enum FPGA_BUFFER buffer)
 	transfer_spi0_24_byte(0x5, buffer);
 }
 
+static void fpga_reset_hold_load()
+{
+	if (fpga_reset_hold_loaded)
+		return;
+
+	config_t cfg;
+	config_load(&cfg);
+
+	// Anything learning can't produce is a stale or corrupt entry, start over from the fixed hold
+	if (cfg.reset_hold_ms < FPGA_RESET_HOLD_MIN_MS || cfg.reset_hold_ms > FPGA_RESET_HOLD_MAX_MS)
+		cfg.reset_hold_ms = FPGA_RESET_HOLD_UNKNOWN;
+	fpga_reset_hold_ms = cfg.reset_hold_ms;
+	fpga_reset_hold_flash_ms = cfg.reset_hold_ms;
+	fpga_reset_hold_loaded = 1;
+}
+
+uint16_t fpga_reset_hold_get()
+{
+	fpga_reset_hold_load();
+	return fpga_reset_hold_ms;
+}
+
+uint16_t fpga_reset_recovery_get()
+{
+	return fpga_reset_recovery_ms;
+}
+
+void fpga_reset_hold_saved(uint16_t hold_ms)
+{
+	fpga_reset_hold_flash_ms = hold_ms;
+}
+
+int fpga_reset_hold_changed()
+{
+	fpga_reset_hold_load();
+	if (fpga_reset_hold_ms == fpga_reset_hold_flash_ms)
+		return 0;
+	if (fpga_reset_hold_flash_ms == FPGA_RESET_HOLD_UNKNOWN || fpga_reset_hold_ms == FPGA_RESET_HOLD_UNKNOWN)
+		return 1;
+
+	// Don't wear the flash over jitter
+	uint32_t diff = fpga_reset_hold_ms > fpga_reset_hold_flash_ms ? fpga_reset_hold_ms - fpga_reset_hold_flash_ms : fpga_reset_hold_flash_ms - fpga_reset_hold_ms;
+	return diff > fpga_reset_hold_flash_ms / 4;
+}
+
+static void fpga_reset_hold_learn(uint32_t drop_ms)
+{
+	uint32_t hold_ms = drop_ms + drop_ms / 4 + FPGA_RESET_HOLD_MARGIN_MS;
+	if (hold_ms > FPGA_RESET_HOLD_MAX_MS)
+		hold_ms = FPGA_RESET_HOLD_MAX_MS;
+
+	// Grow right away, shrink slowly so a single quick drop doesn't make the next blind reset too short
+	if (fpga_reset_hold_ms != FPGA_RESET_HOLD_UNKNOWN && hold_ms < fpga_reset_hold_ms)
+		hold_ms = (fpga_reset_hold_ms * 3 + hold_ms) / 4;
+
+	fpga_reset_hold_ms = hold_ms;
+}
+
+static void fpga_clock_stuck_reset()
+{
+	uint16_t rail_off = adc_rail_poweron_threshold;
+	uint32_t hold_ms = fpga_reset_hold_get();
+
+	// Only a drop from above the threshold times the reset. A rail that is already low would
+	// fire the watchdog at once and teach a hold far too short, so don't watch it at all.
+	if (rail_off && adc_wait_eoc_read() < rail_off)
+		rail_off = 0;
+
+	// Without the rail to watch, hold for the learned time
+	if (rail_off || hold_ms == FPGA_RESET_HOLD_UNKNOWN)
+		hold_ms = FPGA_RESET_HOLD_MAX_MS;
+
+	transfer_spi0_24_6(0x40);
+	if (rail_off)
+		adc_watch_start(rail_off, 0xFFF);
+
+	int dropped = 0;
+	delay_elapsed_t elapsed;
+	delay_elapsed_start(&elapsed);
+	while (delay_elapsed_us(&elapsed) < hold_ms * 1000)
+	{
+		// The ADC watchdog posts this when the rail drops, never without the rail to watch
+		if (sched_event_wait(SCHED_EVENT_MASK(SCHED_EVENT_ADC_THRESHOLD), SCHED_EVENT_SLICE_US))
+		{
+			fpga_reset_hold_learn(delay_elapsed_us(&elapsed) / 1000);
+			delay_ms(FPGA_RESET_HOLD_MARGIN_MS);
+			dropped = 1;
+			break;
+		}
+	}
+
+	if (rail_off)
+		adc_watch_stop();
+	transfer_spi0_24_6(0);
+
+	// Time the rail coming back up. Callers wait for it anyway, this shows whether a shorter
+	// hold leaves the console slower to recover.
+	fpga_reset_recovery_ms = FPGA_RESET_HOLD_UNKNOWN;
+	if (dropped)
+	{
+		adc_watch_start(0, rail_off);
+		delay_elapsed_start(&elapsed);
+		while (delay_elapsed_us(&elapsed) < FPGA_RESET_HOLD_MAX_MS * 1000)
+		{
+			if (sched_event_wait(SCHED_EVENT_MASK(SCHED_EVENT_ADC_THRESHOLD), SCHED_EVENT_SLICE_US))
+			{
+				fpga_reset_recovery_ms = delay_elapsed_us(&elapsed) / 1000;
+				break;
+			}
+		}
+		adc_watch_stop();
+	}
+	delay_ms(1);
+}
+
 void fpga_reset_device(int do_clock_stuck_glitch)
 {
 	transfer_spi0_24_6(0x80);
@@ -175,10 +513,7 @@ void fpga_reset_device(int do_clock_stuck_glitch)
 	if (do_clock_stuck_glitch == 1)
 	{
 		delay_ms(15);
-		transfer_spi0_24_6(0x40);
-		delay_ms(2000);
-		transfer_spi0_24_6(0);
-		delay_ms(1);
+		fpga_clock_stuck_reset();
 	}
 }
 
@@ -196,11 +531,15 @@ void fpga_glitch_device(glitch_cfg_t *cfg)
 
 uint8_t fpga_read_glitch_flags()
 {
+	if (fpga_status_streaming)
+		return fpga_status_mirror[FPGA_STATUS_GLITCH];
 	return transfer_spi0_26_byte(0xA);
 }
 
 uint8_t fpga_read_mmc_flags()
 {
+	if (fpga_status_streaming)
+		return fpga_status_mirror[FPGA_STATUS_MMC];
 	return transfer_spi0_26_byte(0xB);
 }
 
@@ -250,7 +589,10 @@ void fpga_enter_cmd_mode()
 
 void fpga_pre_recv()
 {
-	while (!(fpga_read_mmc_flags() & FPGA_MMC_BUSY_LOADER_DATA_RCVD));
+	// Commands can take a long while to arrive, doze between polls instead of keeping SPI busy.
+	// FPGA_STATUS edges and the LED timer wake the core early.
+	while (!(fpga_read_mmc_flags() & FPGA_MMC_BUSY_LOADER_DATA_RCVD))
+		delay_sleep_us(FPGA_RECV_POLL_US);
 }
 
 void fpga_post_recv()
@@ -15,17 +15,16 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include "mmc_defs.h"
 #include <adc.h>
 #include <board_id.h>
 #include <config.h>
+#include <delay.h>
 #include <statuscode.h>
 #include <device.h>
 #include <fpga.h>
 #include <glitch.h>
 #include <glitch_heuristic.h>
 #include <leds.h>
-#include <mmc_sniffer.h>
 #include <payload.h>
 #include <sdio.h>
 #include <string.h>
@@ -35,6 +34,8 @@
 #define MAX_GLITCH_WIDTH 85
 #define MIN_GLITCH_WIDTH 15
 #define START_GLITCH_WIDTH ((MAX_GLITCH_WIDTH + MIN_GLITCH_WIDTH) / 2)
+#define GLITCH_CONFIRM_TIMEOUT_US 1000000
+#define GLITCH_CONFIRM_POLL_US 50
 
 enum STATUSCODE glitch_prepare(logger *lgr, session_info_t *session_info, unsigned int *adc_goal);
 enum STATUSCODE glitch_reuse_offsets(logger *lgr, session_info_t *session_info, unsigned int adc_goal);
@@ -43,16 +44,23 @@ enum STATUSCODE glitch_search_new_offset(logger *lgr, session_info_t *session_in
 enum GLITCH_RESULT_TYPE glitch_attempt(logger *lgr, session_info_t *session_info, glitch_cfg_t *glitch_cfg);
 enum STATUSCODE flash_payload_and_update_config(logger *lgr, session_info_t *session_info);
 
-int read_glitch_result(uint8_t *buf)
+// Only the header of the CMD buffer is needed for the captured length at 0x10,
+// then only that many bytes of RESP_DATA are fetched.
+#define GLITCH_RESULT_HEADER_LEN 0x11
+
+int read_glitch_result(uint8_t mmc_flags, uint8_t *buf)
 {
-	if (fpga_read_mmc_flags() & FPGA_MMC_GLITCH_DT_CAPTURED)
+	if (mmc_flags & FPGA_MMC_GLITCH_DT_CAPTURED)
 	{
 		fpga_select_active_buffer(FPGA_BUFFER_CMD);
-		fpga_read_buffer(buf, 512);
+		fpga_read_buffer(buf, GLITCH_RESULT_HEADER_LEN);
 		int datalen = buf[0x10];
 
-		fpga_select_active_buffer(FPGA_BUFFER_RESP_DATA);
-		fpga_read_buffer(buf, 512);
+		if (datalen)
+		{
+			fpga_select_active_buffer(FPGA_BUFFER_RESP_DATA);
+			fpga_read_buffer(buf, datalen);
+		}
 		return datalen;
 	}
 	return 0;
@@ -95,6 +103,14 @@ enum STATUSCODE glitch(logger *lgr, session_info_t *session_info, bool is_traini
 
 	lgr->end();
 
+	// Keep a newly learned reset hold time with the training data
+	if (result == OK_GLITCH_SUCCESS && fpga_reset_hold_changed())
+	{
+		config_t cfg;
+		config_load(&cfg);
+		config_save(&cfg);
+	}
+
 	// Set LED to color indicative of glitch result
 	switch (result)
 	{
@@ -303,6 +319,7 @@ enum GLITCH_RESULT_TYPE glitch_attempt(logger *lgr, session_info_t *session_info
 	// and categorize outcome using eMMC bus monitoring.
 	session_info->glitch_attempt++;
 	fpga_glitch_device(glitch_cfg);
+	fpga_status_stream_start();
 	uint8_t mmc_flags;
 	uint8_t glitch_flags;
 	do
@@ -310,9 +327,13 @@ enum GLITCH_RESULT_TYPE glitch_attempt(logger *lgr, session_info_t *session_info
 		mmc_flags = fpga_read_mmc_flags();
 		glitch_flags = fpga_read_glitch_flags();
 	} while (!(mmc_flags & (FPGA_MMC_GLITCH_SUCCESS | FPGA_MMC_GLITCH_TIMEOUT)));
+	fpga_status_stream_stop();
 
+	// A success is confirmed over the bus below, the capture only matters to the logger then
 	uint8_t data[512];
-	int datalen = read_glitch_result(data);
+	int datalen = 0;
+	if (!(mmc_flags & FPGA_MMC_GLITCH_SUCCESS) || lgr->wants_glitch_data)
+		datalen = read_glitch_result(mmc_flags, data);
 
 	if (mmc_flags & FPGA_MMC_GLITCH_SUCCESS)
 	{
@@ -323,10 +344,14 @@ enum GLITCH_RESULT_TYPE glitch_attempt(logger *lgr, session_info_t *session_info
 		// Confirm glitch success by awaiting command over eMMC bus.
 		// This detects false-positives.
 		fpga_enter_cmd_mode();
-		unsigned int max_flag_reads = 200000; // takes about 1s
+		delay_elapsed_t confirm;
 		unsigned int flag_reads;
-		for (flag_reads = 0; flag_reads < max_flag_reads; flag_reads++)
+		delay_elapsed_start(&confirm);
+		for (flag_reads = 0; delay_elapsed_us(&confirm) < GLITCH_CONFIRM_TIMEOUT_US; flag_reads++)
 		{
+			if (flag_reads)
+				delay_sleep_us(GLITCH_CONFIRM_POLL_US);
+
 			if (fpga_read_mmc_flags() & FPGA_MMC_BUSY_LOADER_DATA_RCVD)
 			{
 				// read buffer so flags get cleared
@@ -364,17 +389,7 @@ enum GLITCH_RESULT_TYPE glitch_attempt(logger *lgr, session_info_t *session_info
 	else
 	{
 		// Analyse eMMC bus traffic to categorize glitch attempt result
-		mmc_sniff_parser_ctx ctx;
-		mmc_sniff_parser_init(&ctx, data, datalen);
-		enum GLITCH_RESULT_TYPE glitch_res = (datalen >= 5) ? GLITCH_RESULT_FAIL_TIMEOUT : GLITCH_RESULT_FAIL_NO_EMMC_COMMS;
-		enum MMC_SNIFFER_PACKET_TYPE sniffer_result;
-		do
-		{
-			sniffer_result = mmc_sniff_parser_parse(&ctx);
-			if (sniffer_result == MMC_SNIFF_PKT_TYPE_COMMAND && (ctx.cmd == MMC_READ_SINGLE_BLOCK || ctx.cmd == MMC_GO_IDLE_STATE))
-				glitch_res = GLITCH_RESULT_FAILED_MMC;
-		} while (sniffer_result != MMC_SNIFF_PKT_TYPE_INVALID);
-
+		enum GLITCH_RESULT_TYPE glitch_res = glitch_classify(mmc_flags, data, datalen);
 		lgr->glitch_result(glitch_cfg, glitch_res, mmc_flags, datalen, data, glitch_flags);
 		return glitch_res;
 	}
@@ -1,6 +1,28 @@
 #include "glitch_heuristic.h"
+#include <fpga.h>
+#include <mmc_sniffer.h>
 #include <stdlib.h>
 
+enum GLITCH_RESULT_TYPE glitch_classify(uint8_t mmc_flags, uint8_t *data, int datalen)
+{
+	if (mmc_flags & FPGA_MMC_GLITCH_SUCCESS)
+		return GLITCH_RESULT_SUCCESS;
+
+	mmc_sniff_summary summary;
+	mmc_sniff_summarize(data, datalen, &summary);
+	switch (summary.outcome)
+	{
+		case MMC_SNIFF_OUTCOME_CONTINUED:
+			return GLITCH_RESULT_FAILED_MMC;
+		case MMC_SNIFF_OUTCOME_GARBLED:
+			return GLITCH_RESULT_FAILED_GARBLED;
+		case MMC_SNIFF_OUTCOME_HANG:
+			return GLITCH_RESULT_FAIL_TIMEOUT;
+		default:
+			return GLITCH_RESULT_FAIL_NO_EMMC_COMMS;
+	}
+}
+
 void heuristic_add_result(glitch_heuristic_t *heuristic, enum GLITCH_RESULT_TYPE result)
 {
 	switch (result)
@@ -15,6 +37,11 @@ void heuristic_add_result(glitch_heuristic_t *heuristic, enum GLITCH_RESULT_TYPE
 		case GLITCH_RESULT_FAILED_MMC:
 			heuristic->block_read_count++;
 			break;
+
+		// The pulse did something without hanging the CPU, so neither longer nor shorter
+		// is indicated. Only counting towards the total makes the next offset more likely.
+		case GLITCH_RESULT_FAILED_GARBLED:
+			break;
 		default:
 			break;
 	}
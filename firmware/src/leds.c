@@ -17,11 +17,11 @@
 #include <gd32f3x0.h>
 #include <leds.h>
 #include <board.h>
+#include <scheduler.h>
 
 #define RED_TIMER TIMER15
 #define GREEN_TIMER TIMER16
 #define BLUE_TIMER TIMER0
-#define PULSE_TIMER TIMER13
 
 #define OFF     0x00, 0x00, 0x00
 #define RED     0x3F, 0x00, 0x00
@@ -33,34 +33,57 @@
 #define PURPLE  0x3F, 0x00, 0x3F
 #define WHITE   0x3F, 0x3F, 0x3F
 
-led_pattern_t led_state = {solid, OFF};
-led_pattern_t led_delayed_state;
-led_pattern_t led_override_state;
-volatile uint32_t led_apply_delay = 0;
-volatile uint32_t led_override_duration = 0;
+// PWM compare values, the timers are inverted so 0x4000 is off
+#define LED_CMP_OFF 0x4000
+#define LED_CMP_UNKNOWN 0xFFFF
+
+// Pattern plus its precomputed compare values, so the tick never divides
+typedef struct
+{
+	led_pattern_t pattern;
+	uint16_t cmp[3];
+} led_shown_t;
+
+static led_shown_t led_state = {{solid, OFF}, {LED_CMP_OFF, LED_CMP_OFF, LED_CMP_OFF}};
+static led_shown_t led_override_state;
+static led_pattern_t led_delayed_state;
 volatile uint16_t led_counter = 0;
 
-led_pattern_t lp_glitch_prepare   = {blink, PURPLE};
-led_pattern_t lp_glitch_glitching = {pulse, PURPLE};
-led_pattern_t lp_glitch_done      = {solid, GREEN};
-led_pattern_t lp_train_prepare    = {blink, YELLOW};
-led_pattern_t lp_train_glitching  = {pulse, YELLOW};
-led_pattern_t lp_train_done       = {solid, YELLOW};
-led_pattern_t lp_usb              = {pulse, BLUE};
-led_pattern_t lp_toolbox          = {pulse, GREEN};
-led_pattern_t lp_fw_write         = {blink, RED};
-led_pattern_t lp_fw_read          = {blink, ORANGE};
-led_pattern_t lp_flash_payload    = {blink, ORANGE};
-led_pattern_t lp_err_emmc         = {solid, RED};
-led_pattern_t lp_err_exhausted    = {pulse, RED};
-led_pattern_t lp_err_adc_timeout  = {blink, CYAN};
-led_pattern_t lp_err_adc          = {solid, WHITE};
-led_pattern_t lp_err_fpga         = {solid, CYAN};
-led_pattern_t lp_err_glitch       = {solid, PURPLE};
-led_pattern_t lp_err_firmware     = {solid, ORANGE};
-led_pattern_t lp_err_unknown      = {solid, ORANGE};
-led_pattern_t lp_config_reset     = {solid, BLUE};
-led_pattern_t lp_off              = {solid, 0, 0, 0};
+// Last values written to the compare registers, only changes are written
+static uint16_t led_out[3] = {LED_CMP_UNKNOWN, LED_CMP_UNKNOWN, LED_CMP_UNKNOWN};
+
+static const led_step_t *led_seq;
+static uint8_t led_seq_len;
+static uint8_t led_seq_pos;
+static uint8_t led_seq_loop;
+
+static sched_timer_t led_step_timer;
+static sched_timer_t led_delay_timer;
+static sched_timer_t led_override_timer; // override shown while armed
+
+static void led_step_start();
+
+const led_pattern_t lp_glitch_prepare   = {blink, PURPLE};
+const led_pattern_t lp_glitch_glitching = {pulse, PURPLE};
+const led_pattern_t lp_glitch_done      = {solid, GREEN};
+const led_pattern_t lp_train_prepare    = {blink, YELLOW};
+const led_pattern_t lp_train_glitching  = {pulse, YELLOW};
+const led_pattern_t lp_train_done       = {solid, YELLOW};
+const led_pattern_t lp_usb              = {pulse, BLUE};
+const led_pattern_t lp_toolbox          = {pulse, GREEN};
+const led_pattern_t lp_fw_write         = {blink, RED};
+const led_pattern_t lp_fw_read          = {blink, ORANGE};
+const led_pattern_t lp_flash_payload    = {blink, ORANGE};
+const led_pattern_t lp_err_emmc         = {solid, RED};
+const led_pattern_t lp_err_exhausted    = {pulse, RED};
+const led_pattern_t lp_err_adc_timeout  = {blink, CYAN};
+const led_pattern_t lp_err_adc          = {solid, WHITE};
+const led_pattern_t lp_err_fpga         = {solid, CYAN};
+const led_pattern_t lp_err_glitch       = {solid, PURPLE};
+const led_pattern_t lp_err_firmware     = {solid, ORANGE};
+const led_pattern_t lp_err_unknown      = {solid, ORANGE};
+const led_pattern_t lp_config_reset     = {solid, BLUE};
+const led_pattern_t lp_off              = {solid, 0, 0, 0};
 
 
 void leds_init()
@@ -78,10 +101,8 @@ void leds_init()
 	rcu_periph_clock_enable(RCU_TIMER15); // red
 	rcu_periph_clock_enable(RCU_TIMER16); // green
 	rcu_periph_clock_enable(RCU_TIMER0);  // blue
-	rcu_periph_clock_enable(RCU_TIMER13); // pulse/blink/delay
 
 	timer_deinit(BLUE_TIMER);
-	timer_deinit(PULSE_TIMER);
 
 	timer_parameter_struct initpara;
 	initpara.prescaler = 0x6B;
@@ -123,18 +144,6 @@ void leds_init()
 	timer_primary_output_config(BLUE_TIMER, ENABLE);
 	timer_auto_reload_shadow_enable(BLUE_TIMER);
 
-	// configure timer to 1.024KHz
-	initpara.prescaler = 49;
-	initpara.alignedmode = TIMER_COUNTER_EDGE;
-	initpara.counterdirection = TIMER_COUNTER_UP;
-	initpara.clockdivision = TIMER_CKDIV_DIV1;
-	initpara.repetitioncounter = 0;
-	initpara.period = 1874;
-	timer_init(PULSE_TIMER, &initpara);
-	timer_update_event_enable(PULSE_TIMER);
-	timer_interrupt_enable(PULSE_TIMER, 1);
-	timer_update_source_config(PULSE_TIMER, 1);
-
 	timer_channel_output_pulse_value_config(RED_TIMER, 0, 0x4000);
 	timer_channel_output_pulse_value_config(GREEN_TIMER, 0, 0x4000);
 	timer_channel_output_pulse_value_config(BLUE_TIMER, 2, 0x4000);
@@ -142,119 +151,181 @@ void leds_init()
 	timer_enable(BLUE_TIMER);
 	timer_enable(GREEN_TIMER);
 	timer_enable(RED_TIMER);
-	timer_enable(PULSE_TIMER);
 
-	nvic_irq_enable(TIMER13_IRQn, 1, 1);
+	led_out[0] = led_out[1] = led_out[2] = LED_CMP_UNKNOWN;
+	led_step_start();
 }
 
-static void led_set_red_color(uint8_t value)
+static void led_output(uint16_t red, uint16_t green, uint16_t blue)
 {
-	timer_channel_output_pulse_value_config(RED_TIMER, 0, 0x4000 - ((0x4000 * value) / 0xFF));
+	if (led_out[0] != red)
+	{
+		led_out[0] = red;
+		timer_channel_output_pulse_value_config(RED_TIMER, 0, red);
+	}
+	if (led_out[1] != green)
+	{
+		led_out[1] = green;
+		timer_channel_output_pulse_value_config(GREEN_TIMER, 0, green);
+	}
+	if (led_out[2] != blue)
+	{
+		led_out[2] = blue;
+		timer_channel_output_pulse_value_config(BLUE_TIMER, 2, blue);
+	}
 }
 
-void led_set_green_color(uint8_t value)
+static void led_prepare(led_shown_t *shown, const led_pattern_t *pattern)
 {
-	timer_channel_output_pulse_value_config(GREEN_TIMER, 0, 0x4000 - ((0x4000 * value) / 0xFF));
+	shown->pattern = *pattern;
+	shown->cmp[0] = LED_CMP_OFF - ((LED_CMP_OFF * pattern->red) / 0xFF);
+	shown->cmp[1] = LED_CMP_OFF - ((LED_CMP_OFF * pattern->green) / 0xFF);
+	shown->cmp[2] = LED_CMP_OFF - ((LED_CMP_OFF * pattern->blue) / 0xFF);
 }
 
-static void led_set_blue_color(uint8_t value)
+static void led_step(void *arg)
 {
-	timer_channel_output_pulse_value_config(BLUE_TIMER, 2, 0x4000 - ((0x4000 * value) / 0xFF));
+	const led_shown_t *shown = led_override_timer.active ? &led_override_state : &led_state;
+	const led_pattern_t *pattern = &shown->pattern;
+
+	if (pattern->type == solid)
+	{
+		led_output(shown->cmp[0], shown->cmp[1], shown->cmp[2]);
+
+		// Nothing changes until the next pattern, override or its expiry
+		sched_timer_stop(&led_step_timer);
+		return;
+	}
+
+	if (pattern->type == blink)
+	{
+		led_counter &= 0xFF; // reduce to 4Hz
+		if (led_counter < 64)
+			led_output(shown->cmp[0], shown->cmp[1], shown->cmp[2]);
+		else
+			led_output(LED_CMP_OFF, LED_CMP_OFF, LED_CMP_OFF);
+	}
+	else // pulse
+	{
+		uint16_t val = 0x4000 - (((led_counter < 512) ? led_counter : (1024 - led_counter)) << 5);
+		led_output(pattern->red ? val : LED_CMP_OFF, pattern->green ? val : LED_CMP_OFF, pattern->blue ? val : LED_CMP_OFF);
+	}
+
+	led_counter++;
+	led_counter &= 0x3ff; // overflow at 1Hz
 }
 
-led_pattern_t leds_get_pattern()
+// Pattern steps run off the scheduler tick, (re)started on every change so the bootloader's
+// SDIO path (which never calls leds_init()) animates too.
+static void led_step_start()
 {
-	return led_state;
+	if (!led_step_timer.active)
+		sched_timer_start(&led_step_timer, 1, 1, led_step, 0);
 }
 
-void leds_set_pattern(const led_pattern_t *pattern)
+static void led_show(const led_pattern_t *pattern)
 {
 	// reset blink/pulse counter only when pattern changes
-	if (led_state.type != pattern->type || led_state.red != pattern->red ||
-		led_state.green != pattern->green || led_state.blue != pattern->blue)
+	if (led_state.pattern.type != pattern->type || led_state.pattern.red != pattern->red ||
+		led_state.pattern.green != pattern->green || led_state.pattern.blue != pattern->blue)
 	{
 		led_counter = 0;
 	}
 
-	led_state = *pattern;
-	led_apply_delay = 0; // cancel outstanding delayed pattern applications
+	led_prepare(&led_state, pattern);
+	led_step_start();
 }
 
-void leds_set_pattern_delayed(const led_pattern_t *pattern, int delay_ms)
+led_pattern_t leds_get_pattern()
 {
-	led_delayed_state = *pattern;
-	led_apply_delay = delay_ms; // cancel outstanding delayed pattern applications
+	return led_state.pattern;
 }
 
-void leds_override(uint32_t duration_ms, const led_pattern_t *pattern)
+void leds_set_pattern(const led_pattern_t *pattern)
 {
-	led_override_state = *pattern;
-	led_override_duration = duration_ms;
+	led_seq = 0;
+	sched_timer_stop(&led_delay_timer); // cancel outstanding delayed pattern applications and sequences
+	led_show(pattern);
 }
 
-void leds_off()
+static void led_apply_delayed(void *arg)
 {
-	timer_disable(BLUE_TIMER);
-	timer_disable(GREEN_TIMER);
-	timer_disable(RED_TIMER);
-	timer_disable(PULSE_TIMER);
-
-	rcu_periph_clock_disable(RCU_TIMER15); // red
-	rcu_periph_clock_disable(RCU_TIMER16); // green
-	rcu_periph_clock_disable(RCU_TIMER0);  // blue
-	rcu_periph_clock_disable(RCU_TIMER13); // pulse/blink/delay
-
-	nvic_irq_disable(TIMER13_IRQn);
+	leds_set_pattern(&led_delayed_state);
 }
 
-void apply_led_pattern(const led_pattern_t *pattern)
+void leds_set_pattern_delayed(const led_pattern_t *pattern, int delay_ms)
 {
-	if (pattern->type == solid)
-	{
-		led_set_red_color(pattern->red);
-		led_set_green_color(pattern->green);
-		led_set_blue_color(pattern->blue);
-	}
-	else if (pattern->type == blink)
-	{
-		led_set_red_color(led_counter < 64 ? pattern->red : 0);
-		led_set_green_color(led_counter < 64 ? pattern->green : 0);
-		led_set_blue_color(led_counter < 64 ? pattern->blue : 0);
-		led_counter &= 0xFF; // reduce to 4Hz
-	}
-	else // pulse
+	if (delay_ms <= 0)
 	{
-		uint32_t val = 0x4000 - (((led_counter < 512) ? led_counter : (1024 - led_counter)) << 5);
-		timer_channel_output_pulse_value_config(RED_TIMER, 0, pattern->red ? val : 0x4000);
-		timer_channel_output_pulse_value_config(GREEN_TIMER, 0, pattern->green ? val : 0x4000);
-		timer_channel_output_pulse_value_config(BLUE_TIMER, 2, pattern->blue ? val : 0x4000);
+		leds_set_pattern(pattern);
+		return;
 	}
+
+	led_seq = 0;
+	led_delayed_state = *pattern;
+	sched_timer_start(&led_delay_timer, delay_ms, 0, led_apply_delayed, 0); // replaces outstanding delayed pattern applications
 }
 
-void TIMER13_IRQHandler()
+static void led_seq_next(void *arg)
 {
-	timer_interrupt_flag_clear(PULSE_TIMER, 1);
+	if (!led_seq)
+		return;
 
-	if (led_apply_delay > 0)
+	if (led_seq_pos >= led_seq_len)
 	{
-		led_apply_delay--;
-		if (!led_apply_delay)
+		if (!led_seq_loop)
 		{
-			leds_set_pattern(&led_delayed_state);
+			led_seq = 0;
+			return;
 		}
+		led_seq_pos = 0;
 	}
 
-	// Check override
-	if (led_override_duration > 0)
-	{
-		--led_override_duration;
-		apply_led_pattern(&led_override_state);
-	}
+	const led_step_t *step = &led_seq[led_seq_pos++];
+	led_show(&step->pattern);
+	if (step->duration_ms)
+		sched_timer_start(&led_delay_timer, step->duration_ms, 0, led_seq_next, 0);
 	else
-	{
-		apply_led_pattern(&led_state);
-	}
+		led_seq = 0;
+}
 
-	led_counter++;
-	led_counter &= 0x3ff; // overflow at 1Hz
-}
\ No newline at end of file
+void leds_play_sequence(const led_step_t *steps, uint8_t count, bool loop)
+{
+	sched_timer_stop(&led_delay_timer);
+	led_seq = steps;
+	led_seq_len = count;
+	led_seq_pos = 0;
+	led_seq_loop = loop;
+	led_seq_next(0);
+}
+
+static void led_override_done(void *arg)
+{
+	led_step_start();
+}
+
+void leds_override(uint32_t duration_ms, const led_pattern_t *pattern)
+{
+	led_prepare(&led_override_state, pattern);
+	if (duration_ms)
+		sched_timer_start(&led_override_timer, duration_ms, 0, led_override_done, 0);
+	else
+		sched_timer_stop(&led_override_timer);
+	led_step_start();
+}
+
+void leds_off()
+{
+	timer_disable(BLUE_TIMER);
+	timer_disable(GREEN_TIMER);
+	timer_disable(RED_TIMER);
+
+	rcu_periph_clock_disable(RCU_TIMER15); // red
+	rcu_periph_clock_disable(RCU_TIMER16); // green
+	rcu_periph_clock_disable(RCU_TIMER0);  // blue
+
+	led_seq = 0;
+	sched_timer_stop(&led_step_timer);
+	sched_timer_stop(&led_delay_timer);
+	sched_timer_stop(&led_override_timer);
+}
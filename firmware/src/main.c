@@ -27,6 +27,7 @@
 #include <sdio.h>
 #include <timer.h>
 #include <session_info.h>
+#include <scheduler.h>
 
 void systick_irq_config(void)
 {
@@ -45,6 +46,7 @@ void enter_sleep()
 {
 	systick_irq_disable();
 	leds_off();
+	sched_stop();
 	fpga_power_off();
 	while (1)
 		pmu_to_standbymode(WFI_CMD);
@@ -56,6 +58,7 @@ void firmware_main()
 	systick_irq_config();
 	timer_global_init();
 	clocks_init();
+	sched_init();
 	leds_init();
 	clock_output_init();
 	fpga_init();
@@ -63,36 +66,14 @@ void firmware_main()
 	adc_init(CONSOLE_STATE_ADC_PORT, CONSOLE_STATE_ADC_PIN, 3);
 	g_session_info.startup_adc_value = adc_wait_eoc_read();
 
-	int syncAttempt = 100;
 	SCB->CCR = SCB->CCR & ~(1 << 3); // no hardfault on UA
 
-	while (1)
+	fpga_events_init();
+	if (fpga_wait_sync(FPGA_SYNC_TIMEOUT_US) != OK)
 	{
-		gpio_mode_set(GPIOF, GPIO_MODE_INPUT, GPIO_PUPD_PULLUP, BIT(7));
-		delay_ms(5u);
-		int pinWhilePulledUp = gpio_input_bit_get(GPIOF, BIT(7));
-
-		// configure GPIO to input with pull-down
-		gpio_mode_set(GPIOF, GPIO_MODE_INPUT, GPIO_PUPD_PULLDOWN, BIT(7));
-		delay_ms(5u);
-		int pinWhilePulledDown = gpio_input_bit_get(GPIOF, BIT(7));
-
-		if (pinWhilePulledDown && pinWhilePulledUp && syncAttempt < 95)
-		{
-			fpga_sync_failed = 1;
-			break;
-		}
-		if (pinWhilePulledUp == 1) // FPGA was driving it high
-		{
-			break;
-		}
-		if (syncAttempt == 0)
-		{
-			config_reset();
-			leds_set_pattern(&lp_config_reset);
-			while (1) ;
-		}
-		--syncAttempt;
+		config_reset();
+		leds_set_pattern(&lp_config_reset);
+		while (1) ;
 	}
 
 	if (fpga_reset() != OK_FPGA_RESET)
@@ -16,29 +16,16 @@
 
 #include <string.h>
 #include <mmc.h>
+#include <mmc_sniffer.h>
 #include <fpga.h>
 #include <delay.h>
 #include <statuscode.h>
 #include "mmc_defs.h"
 #include "sd.h"
 
-int crc7(uint8_t *buffer, int size)
-{
-	uint8_t crc = 0;
-	for (int i = 0; i < size; i++)
-	{
-		uint8_t c = buffer[i];
-		for (int j = 0; j < 8; j++)
-		{
-			crc <<= 1;
-			if ((crc ^ c) & 0x80)
-				crc ^= 9;
-			c <<= 1;
-		}
-		crc &= 0x7Fu;
-	}
-	return crc;
-}
+// Same poll interval and bound as the old 2000 polls 50us apart
+#define MMC_COMMAND_POLL_US		50
+#define MMC_COMMAND_TIMEOUT_US	100000
 
 int mmc_send_command(uint32_t cmd, uint32_t argument, uint32_t *res, uint8_t *io)
 {
@@ -73,12 +60,14 @@ int mmc_send_command(uint32_t cmd, uint32_t argument, uint32_t *res, uint8_t *io
 	fpga_write_buffer(data, 7);
 	fpga_do_mmc_command();
 
-	int retry = 2000;
+	// Not streamed: its DMA interrupt would end every nap after a microsecond
+	delay_elapsed_t elapsed;
+	delay_elapsed_start(&elapsed);
 	while (fpga_read_mmc_flags() & 1)
 	{
-		if (!--retry)
+		if (delay_elapsed_us(&elapsed) >= MMC_COMMAND_TIMEOUT_US)
 			return -1;
-		delay_us(50);
+		delay_sleep_us(MMC_COMMAND_POLL_US);
 	}
 
 	fpga_select_active_buffer(0);
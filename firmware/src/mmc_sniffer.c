@@ -1,44 +1,156 @@
+/*
+ * Copyright (c) 2020 Spacecraft-NX
+ * Copyright (c) 2022 HWFLY-NX
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
 #include "mmc_sniffer.h"
 #include "mmc_defs.h"
 
+// No hardware access in here, so it builds on the host against captured traces too
+
+// R1 bits that mean the card rejected what the host sent
+#define MMC_SNIFF_R1_ERRORS (R1_OUT_OF_RANGE | R1_ADDRESS_ERROR | R1_BLOCK_LEN_ERROR | R1_COM_CRC_ERROR | \
+	R1_ILLEGAL_COMMAND | R1_CARD_ECC_FAILED | R1_CC_ERROR | R1_ERROR | R1_SWITCH_ERROR)
+
+int crc7(const uint8_t *buffer, int size)
+{
+	uint8_t crc = 0;
+	for (int i = 0; i < size; i++)
+	{
+		uint8_t c = buffer[i];
+		for (int j = 0; j < 8; j++)
+		{
+			crc <<= 1;
+			if ((crc ^ c) & 0x80)
+				crc ^= 9;
+			c <<= 1;
+		}
+		crc &= 0x7Fu;
+	}
+	return crc;
+}
+
 void mmc_sniff_parser_init(mmc_sniff_parser_ctx *ctx, uint8_t *data, int datalen)
 {
 	ctx->data = data;
 	ctx->datalen = datalen;
 	ctx->cmd = 0;
+	ctx->arg = 0;
+	ctx->crc_ok = false;
 }
 
 enum MMC_SNIFFER_PACKET_TYPE mmc_sniff_parser_parse(mmc_sniff_parser_ctx *ctx)
 {
-	if (ctx->datalen < 6)
-		return MMC_SNIFF_PKT_TYPE_INVALID; // insufficient data left to sniff full command
+	if (ctx->datalen == 0)
+		return MMC_SNIFF_PKT_TYPE_INVALID;
 
 	uint8_t *data = ctx->data;
 	char flags = data[0];
 	ctx->cmd = flags & 0x3F;
 
 	enum MMC_SNIFFER_PACKET_TYPE packet_type;
+	uint32_t len;
 	if (flags & 0x40) // host --> device command
 	{
-		packet_type = MMC_SNIFF_PKT_TYPE_COMMAND;
 		// Host commands are always 48-bit in length
-		ctx->data += 6;
-		ctx->datalen -= 6;
+		packet_type = MMC_SNIFF_PKT_TYPE_COMMAND;
+		len = 6;
 	}
 	else if (ctx->cmd == MMC_ALL_SEND_CID || ctx->cmd == MMC_SEND_CSD || ctx->cmd == MMC_SEND_CID)
 	{
 		// These 3 commands prompt an 'R2' response type of 136 bit length
 		packet_type = MMC_SNIFF_PKT_TYPE_RESPONSE136;
-		ctx->data += 17;
-		ctx->datalen -= 17;
+		len = 17;
 	}
 	else
 	{
 		// All other commands receive a 48-bit response
 		packet_type = MMC_SNIFF_PKT_TYPE_RESPONSE48;
-		ctx->data += 6;
-		ctx->datalen -= 6;
+		len = 6;
 	}
 
+	if (ctx->datalen < len)
+	{
+		ctx->data += ctx->datalen;
+		ctx->datalen = 0;
+		ctx->crc_ok = false;
+		return MMC_SNIFF_PKT_TYPE_PARTIAL;
+	}
+
+	if (packet_type == MMC_SNIFF_PKT_TYPE_RESPONSE136)
+	{
+		// The CRC covers the CID/CSD register only, not the header byte
+		ctx->arg = 0;
+		ctx->crc_ok = crc7(&data[1], 15) == (data[16] >> 1) && (data[16] & 1);
+	}
+	else
+	{
+		ctx->arg = ((uint32_t)data[1] << 24) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 8) | data[4];
+		// R3 has all ones in place of the index and CRC
+		if (packet_type == MMC_SNIFF_PKT_TYPE_RESPONSE48 && ctx->cmd == 0x3F)
+			ctx->crc_ok = data[5] == 0xFF;
+		else
+			ctx->crc_ok = crc7(data, 5) == (data[5] >> 1) && (data[5] & 1);
+	}
+
+	ctx->data += len;
+	ctx->datalen -= len;
 	return packet_type;
 }
+
+void mmc_sniff_summarize(uint8_t *data, int datalen, mmc_sniff_summary *summary)
+{
+	summary->outcome = (datalen >= 5) ? MMC_SNIFF_OUTCOME_HANG : MMC_SNIFF_OUTCOME_NO_COMMS;
+	summary->packets = 0;
+	summary->crc_errors = 0;
+	summary->partial = false;
+	summary->r1_errors = 0;
+	summary->last_read_sector = 0xFFFFFFFF;
+
+	bool continued = false;
+	mmc_sniff_parser_ctx ctx;
+	mmc_sniff_parser_init(&ctx, data, datalen);
+	enum MMC_SNIFFER_PACKET_TYPE packet_type;
+	while ((packet_type = mmc_sniff_parser_parse(&ctx)) != MMC_SNIFF_PKT_TYPE_INVALID)
+	{
+		if (packet_type == MMC_SNIFF_PKT_TYPE_PARTIAL)
+		{
+			summary->partial = true;
+			break;
+		}
+
+		summary->packets++;
+		if (!ctx.crc_ok)
+		{
+			summary->crc_errors++;
+			continue;
+		}
+
+		if (packet_type == MMC_SNIFF_PKT_TYPE_COMMAND)
+		{
+			if (ctx.cmd == MMC_READ_SINGLE_BLOCK)
+				summary->last_read_sector = ctx.arg;
+			if (ctx.cmd == MMC_READ_SINGLE_BLOCK || ctx.cmd == MMC_GO_IDLE_STATE)
+				continued = true;
+		}
+		else if (packet_type == MMC_SNIFF_PKT_TYPE_RESPONSE48 && ctx.cmd != 0x3F)
+			summary->r1_errors |= ctx.arg & MMC_SNIFF_R1_ERRORS;
+	}
+
+	if (continued)
+		summary->outcome = MMC_SNIFF_OUTCOME_CONTINUED;
+	else if (summary->crc_errors || summary->r1_errors)
+		summary->outcome = MMC_SNIFF_OUTCOME_GARBLED;
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2022 HWFLY-NX
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gd32f3x0.h>
+#include <scheduler.h>
+#include <timer.h>
+#include <delay.h>
+
+#define SCHED_TIMER TIMER13
+
+// Hashed timer wheel: a timer sits in slot (expires % SCHED_WHEEL_SLOTS) and each tick only
+// walks one slot. Kept small, the bootloader has 0x300 bytes of RAM and only a handful of
+// timers exist at a time.
+#define SCHED_WHEEL_SLOTS 8
+
+static sched_timer_t *sched_wheel[SCHED_WHEEL_SLOTS];
+static volatile uint32_t sched_ticks;
+static volatile uint32_t sched_events;
+
+void sched_init()
+{
+	rcu_periph_clock_enable(RCU_TIMER13);
+	timer_deinit(SCHED_TIMER);
+
+	// configure timer to 1.024KHz
+	timer_parameter_struct initpara;
+	initpara.prescaler = 49;
+	initpara.alignedmode = TIMER_COUNTER_EDGE;
+	initpara.counterdirection = TIMER_COUNTER_UP;
+	initpara.clockdivision = TIMER_CKDIV_DIV1;
+	initpara.repetitioncounter = 0;
+	initpara.period = 1874;
+	timer_init(SCHED_TIMER, &initpara);
+	timer_update_event_enable(SCHED_TIMER);
+	timer_interrupt_enable(SCHED_TIMER, TIMER_INT_UP);
+	timer_update_source_config(SCHED_TIMER, TIMER_UPDATE_SRC_GLOBAL);
+	timer_enable(SCHED_TIMER);
+
+	nvic_irq_enable(TIMER13_IRQn, 1, 1);
+}
+
+void sched_stop()
+{
+	timer_disable(SCHED_TIMER);
+	rcu_periph_clock_disable(RCU_TIMER13);
+	nvic_irq_disable(TIMER13_IRQn);
+}
+
+uint32_t sched_get_ticks()
+{
+	return sched_ticks;
+}
+
+static void sched_link(sched_timer_t *t, uint32_t expires)
+{
+	sched_timer_t **slot = &sched_wheel[expires & (SCHED_WHEEL_SLOTS - 1)];
+	t->expires = expires;
+	t->next = *slot;
+	*slot = t;
+	t->active = 1;
+}
+
+static void sched_unlink(sched_timer_t *t)
+{
+	sched_timer_t **p = &sched_wheel[t->expires & (SCHED_WHEEL_SLOTS - 1)];
+	while (*p && *p != t)
+		p = &(*p)->next;
+	if (*p)
+		*p = t->next;
+	t->active = 0;
+}
+
+void sched_timer_start(sched_timer_t *t, uint32_t delay, uint16_t period, sched_fn_t fn, void *arg)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	if (t->active)
+		sched_unlink(t);
+	t->period = period;
+	t->fn = fn;
+	t->arg = arg;
+	sched_link(t, sched_ticks + (delay ? delay : 1));
+
+	__set_PRIMASK(primask);
+}
+
+void sched_timer_stop(sched_timer_t *t)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	if (t->active)
+		sched_unlink(t);
+
+	__set_PRIMASK(primask);
+}
+
+void TIMER13_IRQHandler()
+{
+	timer_interrupt_flag_clear(SCHED_TIMER, TIMER_INT_FLAG_UP);
+
+	// Account for SysTick wraps even when its interrupt is off
+	SysTick_Handler_cnt();
+
+	uint32_t now = ++sched_ticks;
+	sched_timer_t **slot = &sched_wheel[now & (SCHED_WHEEL_SLOTS - 1)];
+	sched_timer_t *t = *slot;
+	while (t)
+	{
+		// Same slot, later lap
+		if ((int32_t)(now - t->expires) < 0)
+		{
+			t = t->next;
+			continue;
+		}
+
+		sched_unlink(t);
+		if (t->period)
+			sched_link(t, now + t->period);
+		if (t->fn)
+			t->fn(t->arg);
+
+		// Callbacks may have re-armed timers in this slot, start over
+		t = *slot;
+	}
+}
+
+void sched_event_post(enum SCHED_EVENT ev)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	sched_events |= SCHED_EVENT_MASK(ev);
+	__set_PRIMASK(primask);
+}
+
+void sched_event_clear(uint32_t mask)
+{
+	sched_event_take(mask);
+}
+
+uint32_t sched_event_take(uint32_t mask)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	uint32_t events = sched_events & mask;
+	sched_events &= ~events;
+	__set_PRIMASK(primask);
+	return events;
+}
+
+uint32_t sched_event_wait(uint32_t mask, uint32_t timeout_us)
+{
+	delay_elapsed_t elapsed;
+	delay_elapsed_start(&elapsed);
+	while (1)
+	{
+		uint32_t events = sched_event_take(mask);
+		if (events)
+			return events;
+
+		uint32_t elapsed_us = delay_elapsed_us(&elapsed);
+		if (elapsed_us >= timeout_us)
+			return 0;
+
+		// The interrupt posting the event ends the nap early
+		uint32_t left_us = timeout_us - elapsed_us;
+		delay_sleep_us(left_us < SCHED_EVENT_SLICE_US ? left_us : SCHED_EVENT_SLICE_US);
+	}
+}
@@ -3,7 +3,7 @@
 
 static uint32_t timer_global_start;
 static uint32_t timer2_start;
-static int timer_counter = 0;
+static volatile int timer_counter = 0;
 static int timer2_counter_start = 0;
 
 void SysTick_Handler_cnt()
@@ -27,16 +27,26 @@ void timer2_init()
 
 uint32_t timer_global_get_us()
 {
-	uint32_t us = (0x1000000 - SysTick->VAL) / 96;
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	// A wrap that nobody has counted yet would make time jump back by a full SysTick period
+	uint32_t val = SysTick->VAL;
+	if (SysTick->CTRL & (1u << 16))
+	{
+		timer_counter++;
+		val = SysTick->VAL;
+	}
+	uint32_t us = (0x1000000 - val) / 96;
 	us += (uint32_t)timer_counter * 0x2AAAA;
+
+	__set_PRIMASK(primask);
 	return us;
 }
 
 uint32_t timer2_get_us()
 {
-	uint32_t us = (0x1000000 - SysTick->VAL) / 96;
-	us += (uint32_t)(timer_counter - timer2_counter_start) * 0x2AAAA;
-	return us;
+	return timer_global_get_us() - (uint32_t)timer2_counter_start * 0x2AAAA;
 }
 
 uint32_t timer_get_global_total()
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2022 HWFLY-NX
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Host tool: replays glitch results recorded by the debug console ('g') through glitch_classify().
+// Every "@GR1" line is checked against the label it was recorded with (edit the label to curate
+// a corpus), anything else in the log is skipped. Then the corpus is classified in a loop to
+// measure throughput.
+//
+// build: make -C tools, "make -C tools check" replays tools/glitch_corpus.log
+// usage: glitch_replay <log>...
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <glitch_heuristic.h>
+
+#define MAX_RECORDS		0x10000
+#define BENCH_MIN_SECONDS	1.0
+
+typedef struct
+{
+	uint8_t mmc_flags;
+	uint8_t expected;
+	uint16_t datalen;
+	uint8_t data[256];
+} record_t;
+
+static record_t records[MAX_RECORDS];
+static int record_count;
+
+static const char *result_names[] = {"no_comms", "timeout", "failed_mmc", "success", "garbled"};
+
+static const char *result_name(int res)
+{
+	if (res >= 0 && res < (int)(sizeof(result_names) / sizeof(result_names[0])))
+		return result_names[res];
+	return "?";
+}
+
+static int parse_record(const char *line, record_t *rec)
+{
+	unsigned int offset, width, subcycle, mmc_flags, glitch_flags, result, datalen;
+	int pos;
+	if (sscanf(line, "@GR1 %u %u %u %x %x %u %u %n", &offset, &width, &subcycle, &mmc_flags, &glitch_flags, &result, &datalen, &pos) != 7)
+		return 0;
+	if (datalen > sizeof(rec->data) || strlen(line + pos) < datalen * 2)
+		return 0;
+
+	for (unsigned int i = 0; i < datalen; i++)
+	{
+		unsigned int b;
+		if (sscanf(line + pos + i * 2, "%2x", &b) != 1)
+			return 0;
+		rec->data[i] = b;
+	}
+	rec->mmc_flags = mmc_flags;
+	rec->expected = result;
+	rec->datalen = datalen;
+	return 1;
+}
+
+static int load_log(const char *path)
+{
+	FILE *f = fopen(path, "r");
+	if (!f)
+	{
+		perror(path);
+		return 0;
+	}
+
+	char line[1024];
+	int lineno = 0;
+	while (fgets(line, sizeof(line), f))
+	{
+		lineno++;
+		char *tag = strstr(line, "@GR1 ");
+		if (!tag)
+			continue;
+		if (record_count == MAX_RECORDS)
+		{
+			fprintf(stderr, "%s: more than %d records\n", path, MAX_RECORDS);
+			break;
+		}
+		if (!parse_record(tag, &records[record_count]))
+		{
+			fprintf(stderr, "%s:%d: malformed record\n", path, lineno);
+			continue;
+		}
+		record_count++;
+	}
+
+	fclose(f);
+	return 1;
+}
+
+int main(int argc, char **argv)
+{
+	if (argc < 2)
+	{
+		printf("usage: %s <log>...\n", argv[0]);
+		return 1;
+	}
+
+	for (int i = 1; i < argc; i++)
+		if (!load_log(argv[i]))
+			return 1;
+
+	if (!record_count)
+	{
+		printf("no records\n");
+		return 1;
+	}
+
+	int mismatches = 0;
+	int counts[8] = {0};
+	for (int i = 0; i < record_count; i++)
+	{
+		record_t *rec = &records[i];
+		enum GLITCH_RESULT_TYPE res = glitch_classify(rec->mmc_flags, rec->data, rec->datalen);
+		if (res < 8)
+			counts[res]++;
+		if (res != rec->expected)
+		{
+			mismatches++;
+			printf("record %d: expected %s, got %s\n", i, result_name(rec->expected), result_name(res));
+		}
+	}
+
+	for (int i = 0; i < (int)(sizeof(result_names) / sizeof(result_names[0])); i++)
+		printf("%-10s %d\n", result_names[i], counts[i]);
+	printf("%d records, %d mismatches\n", record_count, mismatches);
+
+	// Throughput
+	unsigned long long classified = 0;
+	volatile int sink = 0;
+	clock_t start = clock();
+	double elapsed;
+	do
+	{
+		for (int i = 0; i < record_count; i++)
+			sink += glitch_classify(records[i].mmc_flags, records[i].data, records[i].datalen);
+		classified += record_count;
+		elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+	} while (elapsed < BENCH_MIN_SECONDS);
+	printf("%.0f records/s\n", classified / elapsed);
+
+	return mismatches ? 2 : 0;
+}
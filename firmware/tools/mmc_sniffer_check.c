@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2022 HWFLY-NX
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Host tool: checks the eMMC sniffer frame parser and the capture summary in src/mmc_sniffer.c.
+// CRC7 is checked against frames from the eMMC/SD specs first, then captures are built from
+// frames the bootrom sends and received, with and without damage.
+//
+// build: make -C tools
+// usage: mmc_sniffer_check
+
+#include <stdio.h>
+#include <string.h>
+#include <mmc_sniffer.h>
+#include "mmc_defs.h"
+
+static int failures;
+
+#define CHECK(cond) \
+	do \
+	{ \
+		if (!(cond)) \
+		{ \
+			printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); \
+			failures++; \
+		} \
+	} while (0)
+
+typedef struct
+{
+	uint8_t data[256];
+	int len;
+} capture_t;
+
+// 48-bit frame: index byte (0x40 | cmd for commands), 32-bit argument, CRC7 and end bit
+static void put48(capture_t *cap, uint8_t index, uint32_t arg)
+{
+	uint8_t *p = &cap->data[cap->len];
+	p[0] = index;
+	p[1] = arg >> 24;
+	p[2] = arg >> 16;
+	p[3] = arg >> 8;
+	p[4] = arg;
+	p[5] = (crc7(p, 5) << 1) | 1;
+	cap->len += 6;
+}
+
+static void put_cmd(capture_t *cap, uint8_t cmd, uint32_t arg)
+{
+	put48(cap, 0x40 | cmd, arg);
+}
+
+static void put_r1(capture_t *cap, uint8_t cmd, uint32_t status)
+{
+	put48(cap, cmd, status);
+}
+
+// R3 (OCR) has all ones in place of the index and the CRC
+static void put_r3(capture_t *cap, uint32_t ocr)
+{
+	put48(cap, 0x3F, ocr);
+	cap->data[cap->len - 1] = 0xFF;
+}
+
+// R2: header byte, then the 120 bits of CID/CSD with their CRC7
+static void put_r2(capture_t *cap, uint8_t cmd, const uint8_t reg[15])
+{
+	uint8_t *p = &cap->data[cap->len];
+	p[0] = cmd;
+	memcpy(&p[1], reg, 15);
+	p[16] = (crc7(reg, 15) << 1) | 1;
+	cap->len += 17;
+}
+
+static void check_crc7()
+{
+	// CMD0, CMD8 (SD, 0x1AA) and CMD17 sector 0 as given in the specs, and an R1 to CMD17 with status 0x900
+	static const uint8_t frames[][6] = {
+		{0x40, 0x00, 0x00, 0x00, 0x00, 0x95},
+		{0x48, 0x00, 0x00, 0x01, 0xAA, 0x87},
+		{0x51, 0x00, 0x00, 0x00, 0x00, 0x55},
+		{0x11, 0x00, 0x00, 0x09, 0x00, 0x67},
+	};
+	for (unsigned int i = 0; i < sizeof(frames) / sizeof(frames[0]); i++)
+		CHECK(((crc7(frames[i], 5) << 1) | 1) == frames[i][5]);
+}
+
+static void check_parser()
+{
+	static const uint8_t cid[15] = {0x15, 0x01, 0x00, 0x42, 0x4A, 0x54, 0x41, 0x34, 0x52, 0x03, 0xA1, 0xB2, 0xC3, 0xD4, 0x91};
+	capture_t cap = {0};
+	put_cmd(&cap, MMC_ALL_SEND_CID, 0);
+	put_r2(&cap, MMC_ALL_SEND_CID, cid);
+	put_cmd(&cap, MMC_SEND_OP_COND, 0x40FF8080);
+	put_r3(&cap, 0xC0FF8080);
+	put_cmd(&cap, MMC_READ_SINGLE_BLOCK, 0x1234);
+	put_r1(&cap, MMC_READ_SINGLE_BLOCK, 0x900);
+	cap.data[cap.len++] = 0x4D; // start of a CMD13 cut off by the end of the capture
+
+	mmc_sniff_parser_ctx ctx;
+	mmc_sniff_parser_init(&ctx, cap.data, cap.len);
+
+	CHECK(mmc_sniff_parser_parse(&ctx) == MMC_SNIFF_PKT_TYPE_COMMAND);
+	CHECK(ctx.cmd == MMC_ALL_SEND_CID && ctx.crc_ok);
+
+	CHECK(mmc_sniff_parser_parse(&ctx) == MMC_SNIFF_PKT_TYPE_RESPONSE136);
+	CHECK(ctx.cmd == MMC_ALL_SEND_CID && ctx.crc_ok);
+
+	CHECK(mmc_sniff_parser_parse(&ctx) == MMC_SNIFF_PKT_TYPE_COMMAND);
+	CHECK(ctx.cmd == MMC_SEND_OP_COND && ctx.arg == 0x40FF8080 && ctx.crc_ok);
+
+	CHECK(mmc_sniff_parser_parse(&ctx) == MMC_SNIFF_PKT_TYPE_RESPONSE48);
+	CHECK(ctx.cmd == 0x3F && ctx.arg == 0xC0FF8080 && ctx.crc_ok);
+
+	CHECK(mmc_sniff_parser_parse(&ctx) == MMC_SNIFF_PKT_TYPE_COMMAND);
+	CHECK(ctx.cmd == MMC_READ_SINGLE_BLOCK && ctx.arg == 0x1234 && ctx.crc_ok);
+
+	CHECK(mmc_sniff_parser_parse(&ctx) == MMC_SNIFF_PKT_TYPE_RESPONSE48);
+	CHECK(ctx.cmd == MMC_READ_SINGLE_BLOCK && ctx.arg == 0x900 && ctx.crc_ok);
+
+	CHECK(mmc_sniff_parser_parse(&ctx) == MMC_SNIFF_PKT_TYPE_PARTIAL);
+	CHECK(!ctx.crc_ok);
+	CHECK(mmc_sniff_parser_parse(&ctx) == MMC_SNIFF_PKT_TYPE_INVALID);
+
+	// Any flipped bit fails the CRC, in the header, the payload or the CRC itself
+	for (int bit = 0; bit < 48; bit++)
+	{
+		capture_t bad = {0};
+		put_cmd(&bad, MMC_READ_SINGLE_BLOCK, 0x1234);
+		bad.data[bit / 8] ^= 0x80 >> (bit % 8);
+		mmc_sniff_parser_init(&ctx, bad.data, bad.len);
+		enum MMC_SNIFFER_PACKET_TYPE type = mmc_sniff_parser_parse(&ctx);
+		// Flipping the direction bit turns the command into a response, still with a bad CRC
+		CHECK(type == MMC_SNIFF_PKT_TYPE_COMMAND || type == MMC_SNIFF_PKT_TYPE_RESPONSE48 || type == MMC_SNIFF_PKT_TYPE_RESPONSE136);
+		if (type != MMC_SNIFF_PKT_TYPE_RESPONSE136)
+			CHECK(!ctx.crc_ok);
+	}
+
+	// R2 CRC covers the register only
+	capture_t r2 = {0};
+	put_r2(&r2, MMC_SEND_CSD, cid);
+	r2.data[8] ^= 0x10;
+	mmc_sniff_parser_init(&ctx, r2.data, r2.len);
+	CHECK(mmc_sniff_parser_parse(&ctx) == MMC_SNIFF_PKT_TYPE_RESPONSE136);
+	CHECK(!ctx.crc_ok);
+}
+
+static void summarize(capture_t *cap, mmc_sniff_summary *summary)
+{
+	mmc_sniff_summarize(cap->data, cap->len, summary);
+}
+
+static void check_summary()
+{
+	mmc_sniff_summary s;
+	capture_t cap;
+
+	// Too little to be a frame
+	memset(&cap, 0, sizeof(cap));
+	cap.len = 4;
+	summarize(&cap, &s);
+	CHECK(s.outcome == MMC_SNIFF_OUTCOME_NO_COMMS && s.packets == 0);
+
+	// Bootrom init that stops before reading anything
+	memset(&cap, 0, sizeof(cap));
+	put_cmd(&cap, MMC_SEND_OP_COND, 0x40FF8080);
+	put_r3(&cap, 0xC0FF8080);
+	put_cmd(&cap, MMC_SEND_STATUS, 0x10000);
+	put_r1(&cap, MMC_SEND_STATUS, 0x900);
+	summarize(&cap, &s);
+	CHECK(s.outcome == MMC_SNIFF_OUTCOME_HANG);
+	CHECK(s.packets == 4 && s.crc_errors == 0 && s.r1_errors == 0 && !s.partial);
+	CHECK(s.last_read_sector == 0xFFFFFFFF);
+
+	// Boot read on: the last valid CMD17 wins, a damaged one doesn't count
+	put_cmd(&cap, MMC_READ_SINGLE_BLOCK, 0x80);
+	put_r1(&cap, MMC_READ_SINGLE_BLOCK, 0x900);
+	put_cmd(&cap, MMC_READ_SINGLE_BLOCK, 0x81);
+	cap.data[cap.len - 2] ^= 1;
+	summarize(&cap, &s);
+	CHECK(s.outcome == MMC_SNIFF_OUTCOME_CONTINUED);
+	CHECK(s.packets == 7 && s.crc_errors == 1 && s.last_read_sector == 0x80);
+
+	// CMD0 after the glitch: the eMMC got restarted
+	memset(&cap, 0, sizeof(cap));
+	put_cmd(&cap, MMC_GO_IDLE_STATE, 0);
+	summarize(&cap, &s);
+	CHECK(s.outcome == MMC_SNIFF_OUTCOME_CONTINUED);
+
+	// R1 errors without a hang
+	memset(&cap, 0, sizeof(cap));
+	put_cmd(&cap, MMC_SEND_STATUS, 0x10000);
+	put_r1(&cap, MMC_SEND_STATUS, R1_ILLEGAL_COMMAND | 0x900);
+	summarize(&cap, &s);
+	CHECK(s.outcome == MMC_SNIFF_OUTCOME_GARBLED && s.r1_errors == R1_ILLEGAL_COMMAND);
+
+	// Status bits that aren't errors stay a hang
+	memset(&cap, 0, sizeof(cap));
+	put_cmd(&cap, MMC_SEND_STATUS, 0x10000);
+	put_r1(&cap, MMC_SEND_STATUS, R1_READY_FOR_DATA | R1_APP_CMD);
+	summarize(&cap, &s);
+	CHECK(s.outcome == MMC_SNIFF_OUTCOME_HANG && s.r1_errors == 0);
+
+	// Bad CRC only
+	memset(&cap, 0, sizeof(cap));
+	put_cmd(&cap, MMC_SEND_STATUS, 0x10000);
+	cap.data[3] ^= 0x40;
+	summarize(&cap, &s);
+	CHECK(s.outcome == MMC_SNIFF_OUTCOME_GARBLED && s.crc_errors == 1);
+
+	// A read followed by a frame cut off: still continued, and flagged partial
+	memset(&cap, 0, sizeof(cap));
+	put_cmd(&cap, MMC_READ_SINGLE_BLOCK, 0x40);
+	cap.data[cap.len++] = 0x11;
+	cap.data[cap.len++] = 0x00;
+	summarize(&cap, &s);
+	CHECK(s.outcome == MMC_SNIFF_OUTCOME_CONTINUED && s.partial && s.packets == 1);
+
+	// Every truncation of a full boot read parses without running past the end
+	memset(&cap, 0, sizeof(cap));
+	put_cmd(&cap, MMC_SEND_OP_COND, 0x40FF8080);
+	put_r3(&cap, 0xC0FF8080);
+	put_cmd(&cap, MMC_READ_SINGLE_BLOCK, 0x80);
+	put_r1(&cap, MMC_READ_SINGLE_BLOCK, 0x900);
+	for (int len = 0; len <= cap.len; len++)
+	{
+		mmc_sniff_summarize(cap.data, len, &s);
+		CHECK(s.packets == len / 6);
+		CHECK(s.partial == (len % 6 != 0));
+	}
+}
+
+int main()
+{
+	check_crc7();
+	check_parser();
+	check_summary();
+
+	printf("%d failures\n", failures);
+	return failures != 0;
+}
@@ -0,0 +1,221 @@
+'''
+Copyright (c) 2022 HWFLY-NX
+
+This program is free software; you can redistribute it and/or modify it
+under the terms and conditions of the GNU General Public License,
+version 2, as published by the Free Software Foundation.
+
+This program is distributed in the hope it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+'''
+
+# Generates src/sdram_lz_t21x.inl from src/sdram_t21x.inl.
+# Every sdram_params_t is compressed as its own block (src/lib/lz.c bitstream), so the loader
+# only has to decode the block for its DRAM ID. Config 0 is compressed standalone and serves
+# as the dictionary for all the others (see LZ_UncompressDict()), which keeps the size close
+# to compressing them all in one go. The blocks are concatenated and indexed by
+# _dram_cfg_lz_t21x_index[id] = { offset, compressed size }.
+#
+# usage: gen_sdram_lz.py <sdram_t21x.inl> <sdram_lz_t21x.inl>
+
+import sys, re
+
+LZ_MAX_OFFSET = 100000
+
+def lz_write_var_size(x):
+    y = x >> 3
+    num_bytes = 5
+    while num_bytes >= 2:
+        if y & 0xfe000000:
+            break
+        y = (y << 7) & 0xffffffff
+        num_bytes -= 1
+
+    out = bytearray()
+    for i in range(num_bytes - 1, -1, -1):
+        b = (x >> (i * 7)) & 0x7f
+        if i > 0:
+            b |= 0x80
+        out.append(b)
+    return out
+
+def lz_read_var_size(buf, pos):
+    y = 0
+    while True:
+        b = buf[pos]
+        pos += 1
+        y = (y << 7) | (b & 0x7f)
+        if not b & 0x80:
+            return y, pos
+
+# Same encoding decisions as LZ_Compress() in src/lib/lz.c, so the output is identical.
+# Any match worth coding is at least 4 bytes long, so rather than trying every offset,
+# candidates are taken from a chain of earlier positions sharing the next 4 bytes,
+# nearest first (LZ_Compress() keeps the nearest of equally long matches too).
+# Matches may also reach back into dictionary, which the decoder must already have in place.
+def lz_compress(data, dictionary=bytearray()):
+    if len(data) < 1:
+        return bytearray()
+
+    histogram = [0] * 256
+    for b in bytearray(data):
+        histogram[b] += 1
+    data = bytes(bytearray(dictionary) + bytearray(data))
+    insize = len(data)
+    marker = 0
+    for i in range(1, 256):
+        if histogram[i] < histogram[marker]:
+            marker = i
+
+    chains = {}
+    def insert(pos):
+        if pos + 4 <= insize:
+            chains.setdefault(data[pos:pos + 4], []).append(pos)
+
+    for pos in range(len(dictionary)):
+        insert(pos)
+
+    out = bytearray([marker])
+    inpos = len(dictionary)
+    bytesleft = insize - inpos
+    while True:
+        bestlength = 3
+        bestoffset = 0
+        for cand in reversed(chains.get(data[inpos:inpos + 4], ())):
+            offset = inpos - cand
+            if offset > LZ_MAX_OFFSET:
+                break
+            if offset < 3:
+                continue
+            maxlength = min(bytesleft, offset)
+            length = 4
+            while length < maxlength and data[inpos + length] == data[cand + length]:
+                length += 1
+            if length > maxlength:
+                continue
+            if length > bestlength:
+                bestlength = length
+                bestoffset = offset
+
+        if (bestlength >= 8 or
+            (bestlength == 4 and bestoffset <= 0x0000007f) or
+            (bestlength == 5 and bestoffset <= 0x00003fff) or
+            (bestlength == 6 and bestoffset <= 0x001fffff) or
+            (bestlength == 7 and bestoffset <= 0x0fffffff)):
+            out.append(marker)
+            out += lz_write_var_size(bestlength)
+            out += lz_write_var_size(bestoffset)
+            for pos in range(inpos, inpos + bestlength):
+                insert(pos)
+            inpos += bestlength
+            bytesleft -= bestlength
+        else:
+            symbol = bytearray(data[inpos:inpos + 1])[0]
+            insert(inpos)
+            inpos += 1
+            out.append(symbol)
+            if symbol == marker:
+                out.append(0)
+            bytesleft -= 1
+
+        if bytesleft <= 3:
+            break
+
+    data = bytearray(data)
+    while inpos < insize:
+        out.append(data[inpos])
+        if data[inpos] == marker:
+            out.append(0)
+        inpos += 1
+
+    return out
+
+def lz_uncompress(data, dictionary=bytearray()):
+    out = bytearray(dictionary)
+    if len(data) < 1:
+        return out[len(dictionary):]
+
+    marker = data[0]
+    inpos = 1
+    while inpos < len(data):
+        symbol = data[inpos]
+        inpos += 1
+        if symbol != marker:
+            out.append(symbol)
+        elif data[inpos] == 0:
+            out.append(marker)
+            inpos += 1
+        else:
+            length, inpos = lz_read_var_size(data, inpos)
+            offset, inpos = lz_read_var_size(data, inpos)
+            for i in range(length):
+                out.append(out[len(out) - offset])
+    return out[len(dictionary):]
+
+def parse_cfgs(text):
+    cfgs = {}
+    for m in re.finditer(r'static const uint8_t _dram_cfg_(\d+)_(t21\d)\[(\d+)\]\s*=\s*\{([^}]*)\}', text):
+        data = bytearray(int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]{2}', m.group(4)))
+        if len(data) != int(m.group(3)):
+            raise Exception('_dram_cfg_%s_%s: expected %s bytes, got %d' % (m.group(1), m.group(2), m.group(3), len(data)))
+        cfgs[int(m.group(1))] = (m.group(2), data)
+
+    if not cfgs or sorted(cfgs.keys()) != list(range(len(cfgs))):
+        raise Exception('DRAM configs are missing or not numbered 0..N-1')
+    return cfgs
+
+def format_array(data):
+    lines = []
+    for i in range(0, len(data), 12):
+        lines.append('    ' + ', '.join('0x%02X' % b for b in data[i:i + 12]))
+    return ',\n'.join(lines)
+
+def main(argv):
+    if len(argv) != 3:
+        print('usage: %s <sdram_t21x.inl> <sdram_lz_t21x.inl>' % argv[0])
+        return 1
+
+    with open(argv[1], 'r') as f:
+        text = f.read()
+    header = text[:text.index('static const')]
+    cfgs = parse_cfgs(text)
+    soc = cfgs[0][0]
+
+    blob = bytearray()
+    index = []
+    base = cfgs[0][1]
+    for i in range(len(cfgs)):
+        data = cfgs[i][1]
+        dictionary = base if i != 0 else bytearray()
+        comp = lz_compress(data, dictionary)
+        if lz_uncompress(comp, dictionary) != data:
+            raise Exception('_dram_cfg_%d_%s does not survive a round trip' % (i, soc))
+        index.append((len(blob), len(comp)))
+        blob += comp
+
+    if len(set(len(cfgs[i][1]) for i in range(len(cfgs)))) != 1:
+        raise Exception('DRAM configs differ in size')
+    if len(blob) > 0xFFFF:
+        raise Exception('compressed configs do not fit a 16-bit index')
+
+    with open(argv[2], 'w') as f:
+        f.write(header)
+        f.write('static const uint8_t _dram_cfg_lz_%s[%d] = {\n' % (soc, len(blob)))
+        f.write(format_array(blob))
+        f.write('\n};\n\n')
+        f.write('/* { offset, size } of the compressed config for each DRAM ID. All but the first use config 0 as dictionary. */\n')
+        f.write('static const uint16_t _dram_cfg_lz_%s_index[%d][2] = {\n' % (soc, len(index)))
+        f.write(',\n'.join('    { %d, %d }' % e for e in index))
+        f.write('\n};\n')
+
+    raw = sum(len(cfgs[i][1]) for i in range(len(cfgs)))
+    print('%s: %d configs, %d -> %d bytes' % (soc, len(cfgs), raw, len(blob)))
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
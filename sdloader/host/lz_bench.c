@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2022 HWFLY-NX
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Host tool: checks src/lib/lz.c and times its decoder.
+ *
+ * Every SDRAM config in sdram_lz_t21x.inl is decoded the way sdram_get_params() does it and
+ * compared with sdram_t21x.inl, which also checks that gen_sdram_lz.py's output is current.
+ * Then LZ_Compress() output round-trips through the decoder at every output alignment, over
+ * data with short and word-multiple match offsets. LZ_Compress() never emits a match longer
+ * than its offset, so overlapping matches, which the format allows, are checked from
+ * hand-built streams. Finally the SDRAM decode and a larger
+ * synthetic block are decoded in a loop to measure throughput.
+ *
+ * build: make -C host check
+ * usage: lz_bench [seconds]
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "lib/lz.h"
+#include "sdram_t210.inl"
+#include "sdram_lz_t210.inl"
+#include "sdram_t214.inl"
+#include "sdram_lz_t214.inl"
+
+#define DEFAULT_BENCH_SECONDS   0.5
+#define SYNTHETIC_SIZE          0x8000
+
+typedef struct {
+    const char *name;
+    const uint32_t **cfgs;
+    const uint8_t *lz;
+    const uint16_t (*index)[2];
+    unsigned int count;
+    unsigned int cfg_size;
+} sdram_set_t;
+
+static const sdram_set_t g_sdram_sets[] = {
+    {"t210", _dram_cfgs_t210, _dram_cfg_lz_t210, _dram_cfg_lz_t210_index, 7, sizeof(_dram_cfg_0_t210)},
+    {"t214", _dram_cfgs_t214, _dram_cfg_lz_t214, _dram_cfg_lz_t214_index, 10, sizeof(_dram_cfg_0_t214)},
+};
+
+static uint8_t g_out[2 * SYNTHETIC_SIZE + 0x10];
+static uint8_t g_packed[SYNTHETIC_SIZE + SYNTHETIC_SIZE / 200 + 0x10];
+static uint8_t g_plain[SYNTHETIC_SIZE];
+static int g_failures;
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* As sdram_get_params(): config 0 standalone, any other id against it. */
+static const uint8_t *sdram_decode(const sdram_set_t *set, unsigned int id, uint8_t *buf) {
+    LZ_Uncompress(&set->lz[set->index[0][0]], buf, set->index[0][1]);
+    if (id == 0)
+        return buf;
+
+    LZ_UncompressDict(&set->lz[set->index[id][0]], buf, set->index[id][1], set->cfg_size);
+    return &buf[set->cfg_size];
+}
+
+static void check_sdram(const sdram_set_t *set) {
+    for (unsigned int id = 0; id < set->count; id++) {
+        memset(g_out, 0xA5, sizeof(g_out));
+        const uint8_t *cfg = sdram_decode(set, id, g_out);
+        if (memcmp(cfg, set->cfgs[id], set->cfg_size) != 0) {
+            printf("%s config %u: decoded data differs from sdram_%s.inl\n", set->name, id, set->name);
+            g_failures++;
+        }
+    }
+}
+
+/* Text-like runs with repeats at short and word-multiple distances, and some noise. */
+static void make_synthetic(uint8_t *buf, size_t size, unsigned int seed) {
+    srand(seed);
+    size_t pos = 0;
+    while (pos < size) {
+        size_t run = 1 + rand() % 64;
+        if (run > size - pos)
+            run = size - pos;
+
+        int kind = rand() % 4;
+        size_t offset = kind == 0 ? 1 + rand() % 3 : kind == 1 ? 4 * (1 + rand() % 16) : 1 + rand() % 2000;
+        if (kind == 3 || offset > pos) {
+            for (size_t i = 0; i < run; i++)
+                buf[pos + i] = "etaoin shrdlu"[rand() % 13];
+        } else {
+            for (size_t i = 0; i < run; i++)
+                buf[pos + i] = buf[pos + i - offset];
+        }
+        pos += run;
+    }
+}
+
+static void check_roundtrip(size_t size, unsigned int seed) {
+    make_synthetic(g_plain, size, seed);
+    int packed = LZ_Compress(g_plain, g_packed, size);
+
+    /* The decoder copies words once the output is aligned, so try every starting alignment */
+    for (int align = 0; align < 4; align++) {
+        memset(g_out, 0xA5, size + 8);
+        int len = LZ_Uncompress(g_packed, g_out + align, packed);
+        if (len != (int)size || memcmp(g_out + align, g_plain, size) != 0 || g_out[align + size] != 0xA5) {
+            printf("round trip of %zu bytes (seed %u) at alignment %d failed\n", size, seed, align);
+            g_failures++;
+        }
+    }
+}
+
+/* Literals, then a match of every length for a few short offsets, against a bytewise copy. */
+static void check_overlapping(void) {
+    static const unsigned int offsets[] = {1, 2, 3, 4, 5, 7, 8, 12};
+    const uint8_t marker = 0xFF;
+
+    for (unsigned int o = 0; o < sizeof(offsets) / sizeof(offsets[0]); o++) {
+        for (unsigned int length = 4; length < 100; length++) {
+            for (int align = 0; align < 4; align++) {
+                unsigned int offset = offsets[o], in = 0, size = 0;
+                g_packed[in++] = marker;
+                for (unsigned int i = 0; i < 13 + align; i++)
+                    g_packed[in++] = g_plain[size++] = 'a' + i;
+                g_packed[in++] = marker;
+                g_packed[in++] = length;
+                g_packed[in++] = offset;
+                for (unsigned int i = 0; i < length; i++, size++)
+                    g_plain[size] = g_plain[size - offset];
+
+                memset(g_out, 0xA5, size + 8);
+                int len = LZ_Uncompress(g_packed, g_out, in);
+                if (len != (int)size || memcmp(g_out, g_plain, size) != 0 || g_out[size] != 0xA5) {
+                    printf("overlapping match of %u at offset %u (alignment %d) failed\n", length, offset, align);
+                    g_failures++;
+                }
+            }
+        }
+    }
+}
+
+static void bench_sdram(double seconds) {
+    unsigned long runs = 0;
+    double start = now(), elapsed;
+    do {
+        for (int i = 0; i < 64; i++, runs++) {
+            const sdram_set_t *set = &g_sdram_sets[runs & 1];
+            sdram_decode(set, runs % set->count, g_out);
+        }
+        elapsed = now() - start;
+    } while (elapsed < seconds);
+
+    printf("sdram_get_params() decode: %8.2f us\n", elapsed * 1e6 / runs);
+}
+
+static void bench_block(double seconds) {
+    make_synthetic(g_plain, SYNTHETIC_SIZE, 1);
+    int packed = LZ_Compress(g_plain, g_packed, SYNTHETIC_SIZE);
+
+    unsigned long runs = 0;
+    double start = now(), elapsed;
+    do {
+        LZ_Uncompress(g_packed, g_out, packed);
+        runs++;
+        elapsed = now() - start;
+    } while (elapsed < seconds);
+
+    printf("synthetic 0x%x -> 0x%x:   %8.2f MB/s decoded\n", SYNTHETIC_SIZE, packed, runs * (double)SYNTHETIC_SIZE / elapsed / 1e6);
+}
+
+int main(int argc, char **argv) {
+    double seconds = argc > 1 ? atof(argv[1]) : DEFAULT_BENCH_SECONDS;
+
+    for (unsigned int i = 0; i < sizeof(g_sdram_sets) / sizeof(g_sdram_sets[0]); i++)
+        check_sdram(&g_sdram_sets[i]);
+
+    for (unsigned int seed = 1; seed <= 32; seed++)
+        check_roundtrip(1 + (seed * 977) % 0x1000, seed);
+    check_roundtrip(SYNTHETIC_SIZE, 0);
+    check_overlapping();
+
+    if (g_failures) {
+        printf("%d failures\n", g_failures);
+        return 1;
+    }
+
+    bench_sdram(seconds);
+    bench_block(seconds);
+    return 0;
+}
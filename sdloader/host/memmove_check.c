@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2022 HWFLY-NX
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Host tool: compares chainloader.c's xmemmove() with memmove() over random overlapping and
+ * disjoint buffers, at every mutual alignment and around the 32 byte burst boundaries. On
+ * the host the ldm/stm bursts are built from their C stand-in, so this checks the head, tail
+ * and direction handling around them; the bursts themselves load before they store.
+ *
+ * build: make -C host check
+ * usage: memmove_check [iterations]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chainloader.c"
+
+#define DEFAULT_ITERATIONS  20000
+#define ARENA_SIZE          0x4000
+#define MAX_LEN             0x1000
+
+static uint8_t g_pattern[ARENA_SIZE];
+static uint8_t g_arena[ARENA_SIZE];
+static uint8_t g_expected[ARENA_SIZE];
+static int g_failures;
+
+static void check(size_t dst, size_t src, size_t len) {
+    memcpy(g_arena, g_pattern, ARENA_SIZE);
+    memcpy(g_expected, g_pattern, ARENA_SIZE);
+
+    memmove(g_expected + dst, g_expected + src, len);
+    void *ret = xmemmove(g_arena + dst, g_arena + src, len);
+
+    /* The whole arena, so stray stores outside dst count as well */
+    if (ret != g_arena + dst || memcmp(g_arena, g_expected, ARENA_SIZE) != 0) {
+        if (g_failures++ < 10)
+            printf("xmemmove(arena + 0x%zx, arena + 0x%zx, 0x%zx) differs from memmove()\n", dst, src, len);
+    }
+}
+
+int main(int argc, char **argv) {
+    unsigned int iterations = argc > 1 ? strtoul(argv[1], NULL, 0) : DEFAULT_ITERATIONS;
+    srand(1);
+    for (size_t i = 0; i < ARENA_SIZE; i++)
+        g_pattern[i] = rand();
+
+    /* Every length up to a few bursts, every mutual alignment, overlapping by less than a burst either way */
+    for (size_t len = 0; len < 0x90; len++)
+        for (size_t src = 0x100; src < 0x104; src++)
+            for (size_t dst = 0x100 - 0x24; dst < 0x100 + 0x24; dst++)
+                check(dst, src, len);
+
+    /* Random sizes and distances, mostly overlapping */
+    for (unsigned int n = 0; n < iterations; n++) {
+        size_t len = rand() % MAX_LEN;
+        size_t src = rand() % (ARENA_SIZE - len);
+        size_t dst = n & 1 ? rand() % (ARENA_SIZE - len) : src + rand() % 0x80 - 0x40;
+        if (dst > ARENA_SIZE - len)
+            dst = src;
+        check(dst, src, len);
+    }
+
+    printf("%d failures\n", g_failures);
+    return g_failures != 0;
+}
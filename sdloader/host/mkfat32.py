@@ -0,0 +1,124 @@
+'''
+Copyright (c) 2022 HWFLY-NX
+
+This program is free software; you can redistribute it and/or modify it
+under the terms and conditions of the GNU General Public License,
+version 2, as published by the Free Software Foundation.
+
+This program is distributed in the hope it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>.
+'''
+
+# Builds a sparse SD card image for sd_bench: an MBR with one FAT32 partition holding the
+# given files in its root directory (8.3 names). -f N lays every file out in runs of N
+# clusters with a free cluster between runs, to measure fragmented payloads.
+#
+# usage: mkfat32.py [-c cluster_bytes] [-o partition_lba] [-f run_clusters] -p [NAME=]file... <image>
+
+import argparse, os, struct
+
+SECTOR = 512
+RESERVED = 32
+MIN_CLUSTERS = 65525 + 16   # fewer makes it FAT16 to FatFs
+EOC = 0x0FFFFFFF
+
+def short_name(name):
+    base, _, ext = name.upper().partition('.')
+    if not base or len(base) > 8 or len(ext) > 3 or '.' in ext:
+        raise SystemExit('%s is not an 8.3 name' % name)
+    return base.ljust(8).encode() + ext.ljust(3).encode()
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument('-c', '--cluster', type=int, default=32768)
+    ap.add_argument('-o', '--offset', type=int, default=8192)
+    ap.add_argument('-f', '--fragment', type=int, default=0)
+    ap.add_argument('-p', '--put', action='append', default=[])
+    ap.add_argument('image')
+    args = ap.parse_args()
+
+    spc = args.cluster // SECTOR
+    if spc < 1 or spc > 128 or spc & (spc - 1):
+        raise SystemExit('bad cluster size')
+
+    files = []
+    for put in args.put:
+        name, _, path = put.rpartition('=')
+        data = open(path, 'rb').read()
+        files.append((short_name(name or os.path.basename(path)), data))
+
+    # Root directory in cluster 2, then the files
+    fat = {2: EOC}
+    entries = b''
+    next_cluster = 3
+    placed = []
+    for name, data in files:
+        count = max(1, -(-len(data) // args.cluster))
+        chain = []
+        while len(chain) < count:
+            chain.append(next_cluster)
+            next_cluster += 1
+            if args.fragment and len(chain) % args.fragment == 0:
+                next_cluster += 1
+        for a, b in zip(chain, chain[1:] + [EOC]):
+            fat[a] = b
+        placed.append((chain, data))
+        first = chain[0] if data else 0
+        entries += struct.pack('<11sBBBHHHHHHHI', name, 0x20, 0, 0, 0, 0x21, 0x21, first >> 16, 0, 0x21, first & 0xFFFF, len(data))
+    if len(entries) > args.cluster:
+        raise SystemExit('too many files for one root directory cluster')
+
+    clusters = max(MIN_CLUSTERS, next_cluster)
+    fat_sectors = -(-(clusters + 2) * 4 // SECTOR)
+    data_lba = RESERVED + 2 * fat_sectors
+    part_sectors = data_lba + clusters * spc
+
+    with open(args.image, 'wb') as f:
+        f.truncate((args.offset + part_sectors) * SECTOR)
+
+        def write(lba, data):
+            f.seek((args.offset + lba) * SECTOR)
+            f.write(data)
+
+        mbr = bytearray(SECTOR)
+        mbr[446:462] = struct.pack('<B3sB3sII', 0, b'\xfe\xff\xff', 0x0C, b'\xfe\xff\xff', args.offset, part_sectors)
+        mbr[510:512] = b'\x55\xaa'
+        f.seek(0)
+        f.write(mbr)
+
+        vbr = bytearray(SECTOR)
+        vbr[0:3] = b'\xeb\x58\x90'
+        vbr[3:11] = b'MSWIN4.1'
+        vbr[11:36] = struct.pack('<HBHBHHBHHHII', SECTOR, spc, RESERVED, 2, 0, 0, 0xF8, 0, 63, 255, args.offset, part_sectors)
+        vbr[36:64] = struct.pack('<IHHIHH12x', fat_sectors, 0, 0, 2, 1, 6)
+        vbr[64:90] = struct.pack('<BBBI11s8s', 0x80, 0, 0x29, 0x12345678, b'NO NAME    ', b'FAT32   ')
+        vbr[510:512] = b'\x55\xaa'
+        write(0, vbr)
+        write(6, vbr)
+
+        fsinfo = bytearray(SECTOR)
+        struct.pack_into('<I', fsinfo, 0, 0x41615252)
+        struct.pack_into('<IIII', fsinfo, 484, 0x61417272, 0xFFFFFFFF, 0xFFFFFFFF, 0)
+        struct.pack_into('<I', fsinfo, 508, 0xAA550000)
+        write(1, fsinfo)
+
+        table = bytearray(fat_sectors * SECTOR)
+        struct.pack_into('<II', table, 0, 0x0FFFFFF8, EOC)
+        for cluster, value in fat.items():
+            struct.pack_into('<I', table, cluster * 4, value)
+        write(RESERVED, table)
+        write(RESERVED + fat_sectors, table)
+
+        cluster_lba = lambda c: data_lba + (c - 2) * spc
+        write(cluster_lba(2), entries)
+        for chain, data in placed:
+            for i, cluster in enumerate(chain):
+                write(cluster_lba(cluster), data[i * args.cluster:(i + 1) * args.cluster])
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2022 HWFLY-NX
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Host tool: runs sdloader's boot-time SD path (mount_sd(), sdloader.ini, load_payload())
+ * against a disk image and prints the SD commands, sectors and simulated latency each step
+ * costs. The loaded payload is then checked against the file read back through FatFs.
+ *
+ * build: make -C host
+ * usage: sd_bench [-v] [-b vol_up|vol_down] [-c cmd_us] [-s sector_us] <image> [payload]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "sd_image.h"
+#include "fs_utils.h"
+#include "chainloader.h"
+#include "boot_config.h"
+#include "payload_load.h"
+#include "btn.h"
+
+static sd_image_stats_t g_last;
+
+static void report(const char *step) {
+    sd_image_stats_t *s = &g_sd_image_stats;
+    printf("%-8s %6u cmds (%u single sector) %8llu sectors %8llu us\n", step,
+        s->commands - g_last.commands, s->single_sector_commands - g_last.single_sector_commands,
+        (unsigned long long)(s->sectors - g_last.sectors), (unsigned long long)(s->latency_us - g_last.latency_us));
+    g_last = *s;
+}
+
+static bool check_payload(const char *path) {
+    uint32_t size = get_file_size(path);
+    uint8_t *expected = malloc(size);
+    if (expected == NULL || read_from_file(expected, size, path) != (int)size) {
+        free(expected);
+        return false;
+    }
+
+    /* The staged part goes to PAYLOAD_ADDRESS, the rest was read there directly. */
+    bool ok = memcmp((void *)g_chainloader_entry.src_address, expected, g_chainloader_entry.size) == 0 &&
+        memcmp((void *)(PAYLOAD_ADDRESS + g_chainloader_entry.size), expected + g_chainloader_entry.size, size - g_chainloader_entry.size) == 0;
+    free(expected);
+    return ok;
+}
+
+int main(int argc, char **argv) {
+    uint32_t btn = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "vb:c:s:")) != -1) {
+        switch (opt) {
+            case 'v':
+                g_sd_image_verbose = 1;
+                break;
+            case 'b':
+                btn = strcmp(optarg, "vol_up") == 0 ? BTN_VOL_UP : strcmp(optarg, "vol_down") == 0 ? BTN_VOL_DOWN : 0;
+                break;
+            case 'c':
+                g_sd_image_cmd_us = strtoul(optarg, NULL, 0);
+                break;
+            case 's':
+                g_sd_image_sector_us = strtoul(optarg, NULL, 0);
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-v] [-b vol_up|vol_down] [-c cmd_us] [-s sector_us] <image> [payload]\n", argv[0]);
+                return 2;
+        }
+    }
+    if (optind >= argc) {
+        fprintf(stderr, "usage: %s [-v] [-b vol_up|vol_down] [-c cmd_us] [-s sector_us] <image> [payload]\n", argv[0]);
+        return 2;
+    }
+
+    if (!sd_image_map(0x40000000, 0x40000) || !sd_image_map(PAYLOAD_DRAM_STAGING, PAYLOAD_MAX_SIZE)) {
+        fprintf(stderr, "can't map the IRAM/DRAM payload areas\n");
+        return 1;
+    }
+    if (!sd_image_open(argv[optind])) {
+        perror(argv[optind]);
+        return 1;
+    }
+
+    if (!mount_sd()) {
+        report("mount");
+        return 1;
+    }
+    report("mount");
+
+    const char *path = optind + 1 < argc ? argv[optind + 1] : boot_config_get_payload(btn);
+    report("config");
+
+    int ret = load_payload(path);
+    report("payload");
+
+    sd_image_stats_t *s = &g_sd_image_stats;
+    printf("total    %6u cmds (%u single sector) %8llu sectors %8llu us\n",
+        s->commands, s->single_sector_commands, (unsigned long long)s->sectors, (unsigned long long)s->latency_us);
+
+    if (ret != 0) {
+        printf("%s: load_payload() failed (%d)\n", path, ret);
+        return 1;
+    }
+
+    bool ok = check_payload(path);
+    printf("%s: 0x%x bytes, 0x%zx staged at 0x%08lx, %s\n", path, get_file_size(path),
+        g_chainloader_entry.size, (unsigned long)g_chainloader_entry.src_address, ok ? "contents match" : "CONTENTS DIFFER");
+
+    unmount_sd();
+    sd_image_close();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2022 HWFLY-NX
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Host side of the SD path: a block device backed by an image file in place of the SDMMC
+ * driver, plus the few hardware hooks fs_utils.c and load_payload() call. Every request is
+ * counted and charged a simulated latency of cmd_us + sectors * sector_us.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "sd_image.h"
+#include "fs_utils.h"
+#include "chainloader.h"
+#include "sdram.h"
+#include "mc.h"
+#include "payload_verify.h"
+#include "lib/log.h"
+
+sd_image_stats_t g_sd_image_stats;
+uint32_t g_sd_image_cmd_us = SD_IMAGE_DEFAULT_CMD_US;
+uint32_t g_sd_image_sector_us = SD_IMAGE_DEFAULT_SECTOR_US;
+int g_sd_image_verbose;
+
+static FILE *g_image;
+static uint64_t g_image_sectors;
+
+chainloader_entry_t g_chainloader_entry;
+
+bool sd_image_open(const char *path) {
+    g_image = fopen(path, "r+b");
+    if (g_image == NULL)
+        return false;
+
+    fseek(g_image, 0, SEEK_END);
+    g_image_sectors = (uint64_t)ftell(g_image) / 512;
+    return true;
+}
+
+void sd_image_close(void) {
+    if (g_image != NULL)
+        fclose(g_image);
+    g_image = NULL;
+}
+
+bool sd_image_map(uintptr_t address, size_t size) {
+    /* The payload is read to its real IRAM/DRAM addresses, these have to be free in our address space. */
+    void *p = mmap((void *)address, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    return p == (void *)address;
+}
+
+static void count_request(uint32_t num_sectors, bool is_read) {
+    g_sd_image_stats.commands++;
+    g_sd_image_stats.sectors += num_sectors;
+    if (num_sectors == 1)
+        g_sd_image_stats.single_sector_commands++;
+    if (!is_read)
+        g_sd_image_stats.writes++;
+    g_sd_image_stats.latency_us += g_sd_image_cmd_us + (uint64_t)num_sectors * g_sd_image_sector_us;
+}
+
+static int image_rw(uint32_t sector, uint32_t num_sectors, void *data, bool is_read) {
+    count_request(num_sectors, is_read);
+    if (g_sd_image_verbose)
+        fprintf(stderr, "  %s %u +%u\n", is_read ? "read " : "write", sector, num_sectors);
+
+    if (g_image == NULL || (uint64_t)sector + num_sectors > g_image_sectors)
+        return 0;
+
+    fseek(g_image, (long)sector * 512, SEEK_SET);
+    if (is_read)
+        return fread(data, 512, num_sectors, g_image) == num_sectors;
+    return fwrite(data, 512, num_sectors, g_image) == num_sectors;
+}
+
+int sdmmc_device_read(sdmmc_device_t *device, uint32_t sector, uint32_t num_sectors, void *data) {
+    return image_rw(sector, num_sectors, data, true);
+}
+
+int sdmmc_device_write(sdmmc_device_t *device, uint32_t sector, uint32_t num_sectors, void *data) {
+    return image_rw(sector, num_sectors, data, false);
+}
+
+int sdmmc_device_sd_init(sdmmc_device_t *device, sdmmc_t *sdmmc, SdmmcBusWidth bus_width, SdmmcBusSpeed bus_speed) {
+    device->sdmmc = sdmmc;
+    return g_image != NULL;
+}
+
+int sdmmc_device_finish(sdmmc_device_t *device) {
+    return 1;
+}
+
+void mc_enable_ahb_redirect() {
+}
+
+void mc_disable_ahb_redirect() {
+}
+
+void sdram_init() {
+}
+
+/* Verification runs on the SE, so here it only checks that chunks arrive whole and in order. */
+static uint32_t g_verify_size;
+static uint32_t g_verify_done;
+static bool g_verify_ok;
+
+bool payload_verify_init(const char *path, size_t size) {
+    g_verify_size = size;
+    g_verify_done = 0;
+    g_verify_ok = true;
+    return true;
+}
+
+PayloadVerifyMode payload_verify_get_mode(void) {
+    return PAYLOAD_VERIFY_NONE;
+}
+
+void payload_verify_chunk(const void *chunk, uint32_t chunk_size, uint32_t offset) {
+    if (offset != g_verify_done || (offset + chunk_size != g_verify_size && chunk_size % 0x40))
+        g_verify_ok = false;
+    g_verify_done += chunk_size;
+}
+
+bool payload_verify_finish(void) {
+    return g_verify_ok && g_verify_done == g_verify_size;
+}
+
+void vprint(ScreenLogLevel screen_log_level, const char *fmt, va_list args) {
+    vfprintf(stderr, fmt, args);
+}
+
+void print(ScreenLogLevel screen_log_level, const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    vprint(screen_log_level, fmt, args);
+    va_end(args);
+}
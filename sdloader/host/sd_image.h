@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2022 HWFLY-NX
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FUSEE_HOST_SD_IMAGE_H
+#define FUSEE_HOST_SD_IMAGE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Roughly CMD18 + auto CMD12 + DMA setup, and 512 bytes at ~40MB/s, on SDR104. */
+#define SD_IMAGE_DEFAULT_CMD_US     150
+#define SD_IMAGE_DEFAULT_SECTOR_US  13
+
+typedef struct {
+    uint32_t commands;
+    uint32_t single_sector_commands;
+    uint32_t writes;
+    uint64_t sectors;
+    uint64_t latency_us;
+} sd_image_stats_t;
+
+extern sd_image_stats_t g_sd_image_stats;
+extern uint32_t g_sd_image_cmd_us;
+extern uint32_t g_sd_image_sector_us;
+extern int g_sd_image_verbose;
+
+bool sd_image_open(const char *path);
+void sd_image_close(void);
+
+/* Maps RAM at a fixed address, for the places load_payload() writes to. */
+bool sd_image_map(uintptr_t address, size_t size);
+
+#endif
@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) 2022 HWFLY-NX
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Host tool: runs se.c's SHA-256 paths (one shot, and chunked as payload_verify.c does it)
+ * against a model of the SE hash engine, and checks the digests against the FIPS 180-2
+ * vectors and a software SHA-256 over messages split into random chunks.
+ *
+ * se.c runs unmodified. Its registers are mapped read-only at SE_BASE; every store faults, is
+ * single-stepped and then handed to the model. The model is strict where the hardware is
+ * picky: no empty inputs, and only the last piece of a message may be a partial block.
+ * It is written from the register descriptions, not from hardware traces, so this checks how
+ * se.c programs the engine and splits messages, not how the engine itself behaves.
+ *
+ * build: make -C host check   (x86-64 Linux, the binary must not be PIE: the SE gets 32-bit addresses)
+ * usage: sha256_check [iterations]
+ */
+
+#define _GNU_SOURCE
+#include <signal.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+#include <sys/mman.h>
+
+#include "utils.h"
+#include "se.h"
+
+#define X86_EFLAGS_TF       0x100
+#define DEFAULT_ITERATIONS  300
+#define MAX_MESSAGE_SIZE    0x2000
+
+static volatile tegra_se_t *const g_se = (volatile tegra_se_t *)SE_BASE;
+static uint32_t g_se_before[sizeof(tegra_se_t) / 4];
+static uintptr_t g_se_store;
+static unsigned int g_se_ops;
+static int g_failures;
+
+/* Software SHA-256, the reference for everything below. */
+static const uint32_t g_sha256_k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+static const uint32_t g_sha256_iv[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+};
+
+#define ROR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+static void sha256_block(uint32_t h[8], const uint8_t *p) {
+    uint32_t w[64];
+    for (int i = 0; i < 16; i++)
+        w[i] = (uint32_t)p[i * 4] << 24 | p[i * 4 + 1] << 16 | p[i * 4 + 2] << 8 | p[i * 4 + 3];
+    for (int i = 16; i < 64; i++) {
+        uint32_t s0 = ROR(w[i - 15], 7) ^ ROR(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = ROR(w[i - 2], 17) ^ ROR(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4], f = h[5], g = h[6], hh = h[7];
+    for (int i = 0; i < 64; i++) {
+        uint32_t t1 = hh + (ROR(e, 6) ^ ROR(e, 11) ^ ROR(e, 25)) + ((e & f) ^ (~e & g)) + g_sha256_k[i] + w[i];
+        uint32_t t2 = (ROR(a, 2) ^ ROR(a, 13) ^ ROR(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        hh = g; g = f; f = e; e = d + t1; d = c; c = b; b = a; a = t1 + t2;
+    }
+    h[0] += a; h[1] += b; h[2] += c; h[3] += d; h[4] += e; h[5] += f; h[6] += g; h[7] += hh;
+}
+
+/* Hashes size bytes on top of h, padding as the end of a total_size byte message. */
+static void sha256_tail(uint32_t h[8], const uint8_t *p, size_t size, uint64_t total_size) {
+    for (; size >= 0x40; size -= 0x40, p += 0x40)
+        sha256_block(h, p);
+
+    uint8_t last[0x80] = {0};
+    memcpy(last, p, size);
+    last[size] = 0x80;
+    size_t padded = size < 56 ? 0x40 : 0x80;
+    for (int i = 0; i < 8; i++)
+        last[padded - 1 - i] = (uint8_t)((total_size << 3) >> (i * 8));
+    for (size_t i = 0; i < padded; i += 0x40)
+        sha256_block(h, last + i);
+}
+
+static void sha256_digest(const uint32_t h[8], uint8_t *dst) {
+    for (int i = 0; i < 8; i++) {
+        dst[i * 4] = h[i] >> 24;
+        dst[i * 4 + 1] = h[i] >> 16;
+        dst[i * 4 + 2] = h[i] >> 8;
+        dst[i * 4 + 3] = h[i];
+    }
+}
+
+static void sha256_ref(uint8_t *dst, const uint8_t *src, size_t size) {
+    uint32_t h[8];
+    memcpy(h, g_sha256_iv, sizeof(h));
+    sha256_tail(h, src, size, size);
+    sha256_digest(h, dst);
+}
+
+/* The SE hash engine: SHA256 into SE_HASH_RESULT, padding once the message runs out. */
+static void se_model_error(const char *what) {
+    fprintf(stderr, "SE model: %s\n", what);
+    g_failures++;
+}
+
+static void se_model_sha256(void) {
+    if (g_se->SE_CONFIG != (ENC_MODE_SHA256 | ENC_ALG_SHA | DST_HASHREG)) {
+        se_model_error("operation other than SHA256 into the hash registers");
+        return;
+    }
+
+    const se_ll_t *ll = (const se_ll_t *)(uintptr_t)g_se->SE_IN_LL_ADDR;
+    const uint8_t *src = (const uint8_t *)(uintptr_t)ll->addr_info.address;
+    uint32_t size = ll->addr_info.size;
+    uint32_t total_size = g_se->SE_SHA_MSG_LENGTH[0] >> 3;
+    uint32_t size_left = g_se->SE_SHA_MSG_LEFT[0] >> 3;
+
+    uint32_t h[8];
+    if (g_se->SE_SHA_CONFIG & 1)
+        memcpy(h, g_sha256_iv, sizeof(h));
+    else
+        for (int i = 0; i < 8; i++)
+            h[i] = g_se->SE_HASH_RESULT[i];
+
+    if (ll->num_entries != 0 || size == 0) {
+        se_model_error("input must be a single, non-empty buffer");
+        return;
+    }
+    if (size_left < size) {
+        se_model_error("more input than the message has left");
+        return;
+    }
+
+    if (size_left > size) {
+        if (size & 0x3F) {
+            se_model_error("partial block before the end of the message");
+            return;
+        }
+        for (uint32_t i = 0; i < size; i += 0x40)
+            sha256_block(h, src + i);
+    } else {
+        sha256_tail(h, src, size, total_size);
+    }
+
+    for (int i = 0; i < 8; i++)
+        g_se->SE_HASH_RESULT[i] = h[i];
+}
+
+static void se_model_store(uintptr_t offset, uint32_t before) {
+    volatile uint32_t *reg = (volatile uint32_t *)(SE_BASE + offset);
+
+    if (offset == offsetof(tegra_se_t, SE_INT_STATUS) || offset == offsetof(tegra_se_t, SE_ERR_STATUS)) {
+        /* Write one to clear. */
+        *reg = before & ~*reg;
+    } else if (offset == offsetof(tegra_se_t, SE_OPERATION) && *reg == OP_START) {
+        g_se_ops++;
+        se_model_sha256();
+        g_se->SE_INT_STATUS |= 0x10;
+    }
+}
+
+/* A store to the SE: let it through for one instruction, then look at what it wrote. */
+static void se_segv_handler(int sig, siginfo_t *info, void *context) {
+    uintptr_t addr = (uintptr_t)info->si_addr;
+    if (addr < SE_BASE || addr >= SE_BASE + sizeof(tegra_se_t)) {
+        signal(SIGSEGV, SIG_DFL);
+        return;
+    }
+
+    g_se_store = (addr - SE_BASE) & ~3;
+    g_se_before[g_se_store / 4] = *(volatile uint32_t *)(SE_BASE + g_se_store);
+    mprotect((void *)SE_BASE, sizeof(tegra_se_t), PROT_READ | PROT_WRITE);
+    ((ucontext_t *)context)->uc_mcontext.gregs[REG_EFL] |= X86_EFLAGS_TF;
+}
+
+static void se_trap_handler(int sig, siginfo_t *info, void *context) {
+    ((ucontext_t *)context)->uc_mcontext.gregs[REG_EFL] &= ~X86_EFLAGS_TF;
+    se_model_store(g_se_store, g_se_before[g_se_store / 4]);
+    mprotect((void *)SE_BASE, sizeof(tegra_se_t), PROT_READ);
+}
+
+static int se_model_init(void) {
+    void *p = mmap((void *)SE_BASE, sizeof(tegra_se_t), PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if (p != (void *)SE_BASE)
+        return 0;
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_flags = SA_SIGINFO;
+    sa.sa_sigaction = se_segv_handler;
+    sigaction(SIGSEGV, &sa, NULL);
+    sa.sa_sigaction = se_trap_handler;
+    sigaction(SIGTRAP, &sa, NULL);
+    return 1;
+}
+
+/* The two ways sdloader hashes. Buffers are static, the SE only takes 32-bit addresses. */
+static uint8_t g_message[1000000];
+
+static void hash_oneshot(uint8_t *dst, const uint8_t *src, size_t size) {
+    se_calculate_sha256(dst, src, size);
+}
+
+/* As payload_verify.c: 0x40 byte multiples, the last chunk takes the rest. */
+static void hash_chunked(uint8_t *dst, const uint8_t *src, size_t size, size_t chunk_size) {
+    for (size_t offset = 0; offset < size; offset += chunk_size) {
+        size_t this_size = size - offset < chunk_size ? size - offset : chunk_size;
+        se_sha256_chunk_start(src + offset, this_size, size, size - offset);
+        se_wait_async_op();
+    }
+    se_sha256_get_result(dst);
+}
+
+static void check(const char *name, const uint8_t *got, const uint8_t *expected) {
+    if (memcmp(got, expected, 0x20) == 0)
+        return;
+
+    g_failures++;
+    printf("%s: got ", name);
+    for (int i = 0; i < 0x20; i++)
+        printf("%02x", got[i]);
+    printf(", expected ");
+    for (int i = 0; i < 0x20; i++)
+        printf("%02x", expected[i]);
+    printf("\n");
+}
+
+static void check_message(const char *name, size_t size, const uint8_t *expected) {
+    static const size_t chunk_sizes[] = {0x40, 0x1C0, 0x4000};
+    char what[96];
+    uint8_t got[0x20];
+
+    /* The SE can't hash an empty message, callers special-case it. */
+    if (size == 0)
+        return;
+
+    hash_oneshot(got, g_message, size);
+    snprintf(what, sizeof(what), "%s one shot", name);
+    check(what, got, expected);
+
+    /* Small chunks on big messages only cost time, SE operations are slow to trap */
+    int first = size > MAX_MESSAGE_SIZE ? 2 : 0;
+    for (int i = first; i < (int)(sizeof(chunk_sizes) / sizeof(chunk_sizes[0])); i++) {
+        hash_chunked(got, g_message, size, chunk_sizes[i]);
+        snprintf(what, sizeof(what), "%s chunks of 0x%zx", name, chunk_sizes[i]);
+        check(what, got, expected);
+    }
+}
+
+static void check_vector(const char *name, const char *text, size_t repeat, const char *digest_hex) {
+    size_t len = strlen(text);
+    for (size_t i = 0; i < repeat; i++)
+        memcpy(g_message + i * len, text, len);
+
+    uint8_t expected[0x20];
+    for (int i = 0; i < 0x20; i++)
+        sscanf(digest_hex + i * 2, "%2hhx", &expected[i]);
+
+    uint8_t ref[0x20];
+    sha256_ref(ref, g_message, len * repeat);
+    check(name, ref, expected);
+    check_message(name, len * repeat, expected);
+}
+
+int main(int argc, char **argv) {
+    unsigned int iterations = argc > 1 ? strtoul(argv[1], NULL, 0) : DEFAULT_ITERATIONS;
+
+    if (!se_model_init()) {
+        fprintf(stderr, "can't map the SE registers at 0x%08x\n", SE_BASE);
+        return 1;
+    }
+
+    /* FIPS 180-2 appendix B */
+    check_vector("empty", "", 1, "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    check_vector("abc", "abc", 1, "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    check_vector("448 bit", "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 1,
+        "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+    check_vector("million a", "a", 1000000, "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+
+    /* Random messages in chunks of random whole blocks */
+    srand(1);
+    for (unsigned int n = 0; n < iterations; n++) {
+        size_t size = 1 + rand() % MAX_MESSAGE_SIZE;
+        for (size_t i = 0; i < size; i++)
+            g_message[i] = rand();
+
+        uint8_t expected[0x20], got[0x20];
+        sha256_ref(expected, g_message, size);
+        hash_chunked(got, g_message, size, 0x40 * (1 + rand() % (n & 1 ? 0x40 : 4)));
+
+        char what[64];
+        snprintf(what, sizeof(what), "random #%u (%zu bytes)", n, size);
+        check(what, got, expected);
+    }
+
+    printf("%u SE operations, %d failures\n", g_se_ops, g_failures);
+    return g_failures != 0;
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2022 HWFLY-NX
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+
+#include "utils.h"
+#include "btn.h"
+#include "fs_utils.h"
+#include "boot_config.h"
+#include "lib/log.h"
+
+typedef enum {
+    BOOT_ENTRY_DEFAULT  = 0,
+    BOOT_ENTRY_VOL_UP   = 1,
+    BOOT_ENTRY_VOL_DOWN = 2,
+    BOOT_ENTRY_COUNT,
+} BootEntry;
+
+static const char * const g_boot_entry_keys[BOOT_ENTRY_COUNT] = {
+    "default",
+    "vol_up",
+    "vol_down",
+};
+
+static bool g_boot_config_loaded;
+
+/* Empty means not configured. */
+static char g_boot_entry_paths[BOOT_ENTRY_COUNT][BOOT_CONFIG_PATH_MAX];
+
+static bool is_blank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+/* Trims [*start, *end) in place. */
+static void trim(const char **start, const char **end) {
+    while (*start < *end && is_blank(**start))
+        (*start)++;
+    while (*end > *start && is_blank(*(*end - 1)))
+        (*end)--;
+}
+
+static void parse_line(const char *line, const char *end) {
+    trim(&line, &end);
+
+    /* Blank lines, comments and section headers. */
+    if (line == end || *line == '#' || *line == ';' || *line == '[')
+        return;
+
+    const char *eq = memchr(line, '=', end - line);
+    if (eq == NULL) {
+        print(SCREEN_LOG_LEVEL_WARNING, BOOT_CONFIG_PATH ": ignoring \"%.*s\"\n", (int)(end - line), line);
+        return;
+    }
+
+    const char *key = line, *key_end = eq;
+    const char *value = eq + 1, *value_end = end;
+    trim(&key, &key_end);
+    trim(&value, &value_end);
+
+    size_t key_len = key_end - key;
+    size_t value_len = value_end - value;
+    for (unsigned int i = 0; i < BOOT_ENTRY_COUNT; i++) {
+        if (strlen(g_boot_entry_keys[i]) != key_len || memcmp(g_boot_entry_keys[i], key, key_len) != 0)
+            continue;
+
+        if (value_len == 0 || value_len >= BOOT_CONFIG_PATH_MAX) {
+            print(SCREEN_LOG_LEVEL_WARNING, BOOT_CONFIG_PATH ": bad path for %s\n", g_boot_entry_keys[i]);
+            return;
+        }
+
+        memcpy(g_boot_entry_paths[i], value, value_len);
+        g_boot_entry_paths[i][value_len] = '\0';
+        return;
+    }
+
+    print(SCREEN_LOG_LEVEL_WARNING, BOOT_CONFIG_PATH ": unknown key \"%.*s\"\n", (int)key_len, key);
+}
+
+static void load_boot_config(void) {
+    char buf[BOOT_CONFIG_MAX_SIZE];
+
+    g_boot_config_loaded = true;
+
+    /* No file costs a single directory lookup. */
+    int size = read_from_file(buf, sizeof(buf), BOOT_CONFIG_PATH);
+    if (size <= 0)
+        return;
+
+    /* The last line might be cut short, rather not guess. */
+    if (size == sizeof(buf)) {
+        print(SCREEN_LOG_LEVEL_WARNING, BOOT_CONFIG_PATH " is too big, ignoring it\n");
+        return;
+    }
+
+    const char *end = buf + size;
+    for (const char *line = buf; line < end; ) {
+        const char *eol = memchr(line, '\n', end - line);
+        if (eol == NULL)
+            eol = end;
+        parse_line(line, eol);
+        line = eol + 1;
+    }
+}
+
+const char *boot_config_get_payload(uint32_t btn) {
+    BootEntry entry = BOOT_ENTRY_DEFAULT;
+
+    if (!g_boot_config_loaded)
+        load_boot_config();
+
+    if ((btn & (BTN_VOL_UP | BTN_VOL_DOWN)) == BTN_VOL_UP)
+        entry = BOOT_ENTRY_VOL_UP;
+    else if ((btn & (BTN_VOL_UP | BTN_VOL_DOWN)) == BTN_VOL_DOWN)
+        entry = BOOT_ENTRY_VOL_DOWN;
+
+    /* Unconfigured combinations fall back to the default payload. */
+    if (g_boot_entry_paths[entry][0] == '\0')
+        entry = BOOT_ENTRY_DEFAULT;
+    if (g_boot_entry_paths[entry][0] == '\0')
+        return BOOT_CONFIG_DEFAULT_PAYLOAD;
+
+    return g_boot_entry_paths[entry];
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2022 HWFLY-NX
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FUSEE_BOOT_CONFIG_H
+#define FUSEE_BOOT_CONFIG_H
+
+#include "utils.h"
+
+/*
+ * Optional file in the SD root picking the payload by the buttons held at boot, one
+ * "key=path" per line, '#' and ';' start comments:
+ *
+ *     default=payload.bin
+ *     vol_up=hekate.bin
+ *     vol_down=fusee.bin
+ *
+ * VOL+ and VOL- together still boot OFW. VOL+ alone also keeps the modchip awake (no sleep
+ * command), so vol_up= payloads always run with it awake.
+ */
+#define BOOT_CONFIG_PATH        "sdloader.ini"
+#define BOOT_CONFIG_MAX_SIZE    0x400
+#define BOOT_CONFIG_PATH_MAX    0x80
+
+#define BOOT_CONFIG_DEFAULT_PAYLOAD "payload.bin"
+
+/* Payload path for btn_read() bits. The file is only read and parsed on the first call. */
+const char *boot_config_get_payload(uint32_t btn);
+
+#endif
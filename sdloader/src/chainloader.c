@@ -15,24 +15,96 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
  
+#include <stdbool.h>
 #include "chainloader.h"
 
 chainloader_entry_t g_chainloader_entry;
 
 #pragma GCC optimize (3)
 
+#ifdef __arm__
+/* ARM state for the ldm/stm bursts, which also keeps the entry from start.s a plain branch. */
+#pragma GCC target ("arm")
+
+#define XMEMMOVE_BURST_UP(src8, dst8) \
+    __asm__ __volatile__ ( \
+        "ldmia %0!, {r3-r10}\n" \
+        "stmia %1!, {r3-r10}\n" \
+        : "+r" (src8), "+r" (dst8) \
+        : \
+        : "r3", "r4", "r5", "r6", "r7", "r8", "r9", "r10", "memory")
+
+#define XMEMMOVE_BURST_DOWN(src8, dst8) \
+    __asm__ __volatile__ ( \
+        "ldmdb %0!, {r3-r10}\n" \
+        "stmdb %1!, {r3-r10}\n" \
+        : "+r" (src8), "+r" (dst8) \
+        : \
+        : "r3", "r4", "r5", "r6", "r7", "r8", "r9", "r10", "memory")
+#else
+/* Host builds (host/memmove_check.c): the same bursts, all eight words loaded before any is stored. */
+#include <string.h>
+
+#define XMEMMOVE_BURST_UP(src8, dst8) do { \
+        uint32_t burst[8]; \
+        memcpy(burst, src8, sizeof(burst)); \
+        memcpy(dst8, burst, sizeof(burst)); \
+        src8 += sizeof(burst); \
+        dst8 += sizeof(burst); \
+    } while (0)
+
+#define XMEMMOVE_BURST_DOWN(src8, dst8) do { \
+        uint32_t burst[8]; \
+        src8 -= sizeof(burst); \
+        dst8 -= sizeof(burst); \
+        memcpy(burst, src8, sizeof(burst)); \
+        memcpy(dst8, burst, sizeof(burst)); \
+    } while (0)
+#endif
+
+/* Overlap-safe copy in 32 byte ldm/stm bursts. Mutually misaligned buffers fall back to bytes. */
 static void *xmemmove(void *dst, const void *src, size_t len)
 {
     const uint8_t *src8 = (const uint8_t *)src;
     uint8_t *dst8 = (uint8_t *)dst;
+    bool words = (((uintptr_t)dst8 ^ (uintptr_t)src8) & 3) == 0;
 
     if (dst8 < src8) {
-        for (size_t i = 0; i < len; i++) {
-            dst8[i] = src8[i];
+        /* Every burst is loaded before it is stored, so reading ahead of dst is fine. */
+        while (words && ((uintptr_t)src8 & 3) && len) {
+            *dst8++ = *src8++;
+            len--;
+        }
+        if (words) {
+            for (; len >= 0x20; len -= 0x20)
+                XMEMMOVE_BURST_UP(src8, dst8);
+            for (; len >= 4; len -= 4) {
+                *(uint32_t *)dst8 = *(const uint32_t *)src8;
+                dst8 += 4;
+                src8 += 4;
+            }
         }
+        while (len--)
+            *dst8++ = *src8++;
     } else if (dst8 > src8) {
-        for (size_t i = len; i > 0; i--)
-            dst8[i - 1] = src8[i - 1];
+        /* Same thing from the top down. */
+        src8 += len;
+        dst8 += len;
+        while (words && ((uintptr_t)src8 & 3) && len) {
+            *--dst8 = *--src8;
+            len--;
+        }
+        if (words) {
+            for (; len >= 0x20; len -= 0x20)
+                XMEMMOVE_BURST_DOWN(src8, dst8);
+            for (; len >= 4; len -= 4) {
+                dst8 -= 4;
+                src8 -= 4;
+                *(uint32_t *)dst8 = *(const uint32_t *)src8;
+            }
+        }
+        while (len--)
+            *--dst8 = *--src8;
     }
 
     return dst;
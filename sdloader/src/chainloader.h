@@ -24,6 +24,7 @@
 #define CHAINLOADER_ARG_DATA_MAX_SIZE 0x6200
 #define CHAINLOADER_MAX_ENTRIES       128
 
+/* The part of the payload that couldn't be loaded in place, copied to 0x40010000 before jumping there. */
 typedef struct chainloader_entry_t {
     uintptr_t src_address;
     size_t size;
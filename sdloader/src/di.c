@@ -34,6 +34,7 @@
 #include "di.inl"
 
 static uint32_t _display_ver = 0;
+static bool _display_window_ready = false;
 
 static void exec_cfg(uint32_t *base, const cfg_op_t *ops, uint32_t num_ops)
 {
@@ -317,6 +318,7 @@ void display_end()
     
     /* Disable Backlight. */
     display_backlight(false);
+    _display_window_ready = false;
     
     MAKE_DSI_REG(DSI_VIDEO_MODE_CONTROL) = 1;
     MAKE_DSI_REG(DSI_WR_DATA) = 0x2805;
@@ -414,6 +416,11 @@ void display_color_screen(uint32_t color)
 }
 
 uint32_t *display_init_framebuffer(void *address)
+{
+    return display_init_framebuffer_scaled(address, 0);
+}
+
+uint32_t *display_init_framebuffer_scaled(void *address, uint32_t shift)
 {
     static cfg_op_t conf[sizeof(_di_framebuffer)/sizeof(cfg_op_t)] = {0};
     if (conf[0].val == 0) {
@@ -424,11 +431,30 @@ uint32_t *display_init_framebuffer(void *address)
 
     uint32_t *lfb_addr = (uint32_t *)address;
     conf[19].val = (uint32_t)address;
+
+    /* Shrink the surface and let the window DDA scale it back up to 1280x720. */
+    conf[13].val = V_PRESCALED_SIZE(1280 >> shift) | H_PRESCALED_SIZE((720 >> shift) * 4);
+    conf[14].val = V_DDA_INC(0x1000 >> shift) | H_DDA_INC(0x1000 >> shift);
+    conf[16].val = ((768 * 2) << 16) | ((768 >> shift) * 4);
     
     /* This configures the framebuffer @ address with a resolution of 1280x720 (line stride 768). */
     exec_cfg((uint32_t *)DI_BASE, conf, 32);
+    _display_window_ready = true;
 
     udelay(35000);
 
     return lfb_addr;
 }
+
+void display_set_framebuffer_address(void *address)
+{
+    /* The window registers aren't set up (or clocked) before display_init_framebuffer. */
+    if (!_display_window_ready)
+        return;
+
+    /* Latched on the next frame, no need to wait. */
+    MAKE_DI_REG(DC_CMD_DISPLAY_WINDOW_HEADER) = WINDOW_A_SELECT;
+    MAKE_DI_REG(DC_WINBUF_START_ADDR) = (uint32_t)address;
+    MAKE_DI_REG(DC_CMD_STATE_CONTROL) = WIN_A_UPDATE;
+    MAKE_DI_REG(DC_CMD_STATE_CONTROL) = WIN_A_ACT_REQ;
+}
@@ -373,4 +373,11 @@ void display_backlight(bool enable);
 /* Init display in full 1280x720 resolution (B8G8R8A8, line stride 768, framebuffer size = 1280*768*4 bytes). */
 uint32_t *display_init_framebuffer(void *address);
 
+/* Same, with a (1280 >> shift)x(720 >> shift) surface (line stride 768 >> shift) upscaled by the display. */
+/* Small enough to live in IRAM, so it doesn't need DRAM. */
+uint32_t *display_init_framebuffer_scaled(void *address, uint32_t shift);
+
+/* Move the window of an initialized framebuffer to start at address, e.g. to scroll. */
+void display_set_framebuffer_address(void *address);
+
 #endif
@@ -83,6 +83,7 @@ CONFIG_VIDEO_HW_CURSOR:	     - Uses the hardware cursor capability of the
 
 #include <stdint.h>
 #include "video_fb.h"
+#include "../di.h"
 #include <string.h>
 
 
@@ -217,6 +218,14 @@ void	console_cursor (int state);
 #define CONSOLE_SIZE		(CONSOLE_ROW_SIZE * CONSOLE_ROWS)
 #define CONSOLE_SCROLL_SIZE	(CONSOLE_SIZE - CONSOLE_ROW_SIZE)
 
+/*
+ * Without VIDEO_HW_BITBLT the console is a ring of CONSOLE_ROWS text rows, stored twice back to
+ * back. The display window starts at the top row, so scrolling moves the window base instead of
+ * copying the whole screen up. Every row is drawn into both copies, so the window always covers
+ * CONSOLE_ROWS valid rows.
+ */
+#define CONSOLE_RING_SIZE	(CONSOLE_SIZE * 2)
+
 /* Macros */
 #ifdef	VIDEO_FB_LITTLE_ENDIAN
 #define SWAP16(x)	 ((((x) & 0x00ff) << 8) | ( (x) >> 8))
@@ -259,6 +268,7 @@ static int video_logo_height = VIDEO_LOGO_HEIGHT;
 
 static int console_col = 0; /* cursor col */
 static int console_row = 0; /* cursor row */
+static int console_top = 0; /* ring row shown at the top of the window */
 
 static uint32_t eorx, fgx, bgx;  /* color pats */
 
@@ -292,25 +302,6 @@ static const int video_font_draw_table24[16][3] = {
 	    { 0xffffffff, 0xffffffff, 0xff000000 },
 	    { 0xffffffff, 0xffffffff, 0xffffffff } };
 
-static const int video_font_draw_table32[16][4] = {
-	    { 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
-	    { 0x00000000, 0x00000000, 0x00000000, 0x00ffffff },
-	    { 0x00000000, 0x00000000, 0x00ffffff, 0x00000000 },
-	    { 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff },
-	    { 0x00000000, 0x00ffffff, 0x00000000, 0x00000000 },
-	    { 0x00000000, 0x00ffffff, 0x00000000, 0x00ffffff },
-	    { 0x00000000, 0x00ffffff, 0x00ffffff, 0x00000000 },
-	    { 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ffffff },
-	    { 0x00ffffff, 0x00000000, 0x00000000, 0x00000000 },
-	    { 0x00ffffff, 0x00000000, 0x00000000, 0x00ffffff },
-	    { 0x00ffffff, 0x00000000, 0x00ffffff, 0x00000000 },
-	    { 0x00ffffff, 0x00000000, 0x00ffffff, 0x00ffffff },
-	    { 0x00ffffff, 0x00ffffff, 0x00000000, 0x00000000 },
-	    { 0x00ffffff, 0x00ffffff, 0x00000000, 0x00ffffff },
-	    { 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00000000 },
-	    { 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff } };
-
-
 /******************************************************************************/
 
 static void video_drawchars (int xx, int yy, unsigned char *s, int count)
@@ -397,27 +388,25 @@ static void video_drawchars (int xx, int yy, unsigned char *s, int count)
 		break;
 
 	case GDF_32BIT_X888RGB:
+		/* One all-ones/all-zeros mask per pixel straight from the glyph bits, no table lookups. */
 		while (count--) {
 			c = *s;
 			cdat = video_fontdata + c * (VIDEO_FONT_HEIGHT * WIDTH_BYTES);
 			for (rows = VIDEO_FONT_HEIGHT, dest = dest0;
 			     rows--;
 			     dest += VIDEO_LINE_LEN) {
-				cols = 0;
-				tbits = VIDEO_FONT_WIDTH;
-				while (tbits > 0) {
-					uint8_t bits = *cdat++;
-
-					((uint32_t *) dest)[cols + 0] = SWAP32 ((video_font_draw_table32 [bits >> 4][0] & eorx) ^ bgx);
-					((uint32_t *) dest)[cols + 1] = SWAP32 ((video_font_draw_table32 [bits >> 4][1] & eorx) ^ bgx);
-					((uint32_t *) dest)[cols + 2] = SWAP32 ((video_font_draw_table32 [bits >> 4][2] & eorx) ^ bgx);
-					((uint32_t *) dest)[cols + 3] = SWAP32 ((video_font_draw_table32 [bits >> 4][3] & eorx) ^ bgx);
-					((uint32_t *) dest)[cols + 4] = SWAP32 ((video_font_draw_table32 [bits & 15][0] & eorx) ^ bgx);
-					((uint32_t *) dest)[cols + 5] = SWAP32 ((video_font_draw_table32 [bits & 15][1] & eorx) ^ bgx);
-					((uint32_t *) dest)[cols + 6] = SWAP32 ((video_font_draw_table32 [bits & 15][2] & eorx) ^ bgx);
-					((uint32_t *) dest)[cols + 7] = SWAP32 ((video_font_draw_table32 [bits & 15][3] & eorx) ^ bgx);
-					cols += 8;
-					tbits -= 8;
+				uint32_t *d = (uint32_t *) dest;
+				for (tbits = VIDEO_FONT_WIDTH; tbits > 0; tbits -= 8, d += 8) {
+					uint32_t bits = *cdat++;
+
+					d[0] = SWAP32 ((-((bits >> 7) & 1) & eorx) ^ bgx);
+					d[1] = SWAP32 ((-((bits >> 6) & 1) & eorx) ^ bgx);
+					d[2] = SWAP32 ((-((bits >> 5) & 1) & eorx) ^ bgx);
+					d[3] = SWAP32 ((-((bits >> 4) & 1) & eorx) ^ bgx);
+					d[4] = SWAP32 ((-((bits >> 3) & 1) & eorx) ^ bgx);
+					d[5] = SWAP32 ((-((bits >> 2) & 1) & eorx) ^ bgx);
+					d[6] = SWAP32 ((-((bits >> 1) & 1) & eorx) ^ bgx);
+					d[7] = SWAP32 ((-(bits & 1) & eorx) ^ bgx);
 				}
 			}
 			dest0 += VIDEO_FONT_WIDTH * CONFIG_VIDEO_PIXEL_SIZE;
@@ -465,7 +454,14 @@ static inline void video_drawstring (int xx, int yy, unsigned char *s)
 
 static void video_putchar (int xx, int yy, unsigned char c)
 {
+#ifdef VIDEO_HW_BITBLT
 	video_drawchars (xx, yy + video_logo_height, &c, 1);
+#else
+	int row = (console_top + yy / VIDEO_FONT_HEIGHT) % CONSOLE_ROWS;
+
+	video_drawchars (xx, video_logo_height + row * VIDEO_FONT_HEIGHT, &c, 1);
+	video_drawchars (xx, video_logo_height + (row + CONSOLE_ROWS) * VIDEO_FONT_HEIGHT, &c, 1);
+#endif
 }
 
 /*****************************************************************************/
@@ -544,9 +540,8 @@ static void memsetl (int *p, int c, int v)
 
 static void console_scrollup (void)
 {
-	/* copy up rows ignoring the first one */
-
 #ifdef VIDEO_HW_BITBLT
+	/* copy up rows ignoring the first one */
 	video_hw_bitblt (CONFIG_VIDEO_PIXEL_SIZE,	/* bytes per pixel */
 			 0,	/* source pos x */
 			 video_logo_height + VIDEO_FONT_HEIGHT, /* source pos y */
@@ -555,10 +550,6 @@ static void console_scrollup (void)
 			 CONFIG_VIDEO_VISIBLE_COLS,	/* frame width */
 			 CONFIG_VIDEO_VISIBLE_ROWS - video_logo_height - VIDEO_FONT_HEIGHT	/* frame height */
 		);
-#else
-	memmove(CONSOLE_ROW_FIRST, CONSOLE_ROW_SECOND,
-	       CONSOLE_SCROLL_SIZE);
-#endif
 
 	/* clear the last one */
 #ifdef VIDEO_HW_RECTFILL
@@ -572,6 +563,15 @@ static void console_scrollup (void)
 #else
 	memsetl (CONSOLE_ROW_LAST, CONSOLE_ROW_SIZE >> 2, CONSOLE_BG_COL);
 #endif
+#else
+	/* The old top row becomes the new bottom one, clear both copies and move the window. */
+	int row = console_top;
+
+	console_top = (console_top + 1) % CONSOLE_ROWS;
+	memsetl (CONSOLE_ROW_FIRST + row * CONSOLE_ROW_SIZE, CONSOLE_ROW_SIZE >> 2, CONSOLE_BG_COL);
+	memsetl (CONSOLE_ROW_FIRST + (row + CONSOLE_ROWS) * CONSOLE_ROW_SIZE, CONSOLE_ROW_SIZE >> 2, CONSOLE_BG_COL);
+	display_set_framebuffer_address (CONSOLE_ROW_FIRST + console_top * CONSOLE_ROW_SIZE);
+#endif
 }
 
 /*****************************************************************************/
@@ -1528,9 +1528,10 @@ int video_resume(void *videobase, int row, int col) {
 	video_console_address = video_fb_address;
 #endif
 
-	/* Initialize the console */
+	/* Initialize the console, the ring is assumed to be scrolled back to its start */
 	console_col = col;
 	console_row = row;
+	console_top = 0;
 
 	return 0;
 }
@@ -1543,6 +1544,12 @@ int video_get_row(void) {
     return console_row;
 }
 
+const unsigned char *video_get_font(int *width, int *height) {
+    *width = VIDEO_FONT_WIDTH;
+    *height = VIDEO_FONT_HEIGHT;
+    return video_fontdata;
+}
+
 int video_init (void *videobase)
 {
 	unsigned char color8;
@@ -1612,9 +1619,16 @@ int video_init (void *videobase)
 	/* Initialize the console */
 	console_col = 0;
 	console_row = 0;
+	console_top = 0;
 
+#ifdef VIDEO_HW_BITBLT
 	memsetl(CONSOLE_ROW_FIRST, VIDEO_COLS * VIDEO_ROWS,
 		CONSOLE_BG_COL);
+#else
+	memsetl(CONSOLE_ROW_FIRST, CONSOLE_RING_SIZE >> 2,
+		CONSOLE_BG_COL);
+	display_set_framebuffer_address(CONSOLE_ROW_FIRST);
+#endif
 
 	return 0;
 }
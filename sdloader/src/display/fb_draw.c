@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2022 HWFLY-NX
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+
+#include "fb_draw.h"
+#include "video_fb.h"
+
+#define FB_WIDTH        1280
+#define FB_HEIGHT       720
+#define FB_STRIDE       (720 + 48)
+#define FB_MAX_KEEP     4
+
+static uint32_t *g_fb;
+static uint32_t g_shift;
+static int g_width;
+static int g_height;
+static int g_stride;
+
+void fb_draw_init(void *fb, uint32_t shift) {
+    g_fb = (uint32_t *)fb;
+    g_shift = shift;
+    g_width = FB_WIDTH >> shift;
+    g_height = FB_HEIGHT >> shift;
+    g_stride = FB_STRIDE >> shift;
+}
+
+/* Surface coordinates. Screen column x is framebuffer line (width - x), so columns run 1..width. */
+static void fill_surface(int x0, int y0, int x1, int y1, uint32_t color) {
+    if (x0 < 1)
+        x0 = 1;
+    if (x1 > g_width + 1)
+        x1 = g_width + 1;
+    if (y0 < 0)
+        y0 = 0;
+    if (y1 > g_height)
+        y1 = g_height;
+    if (x0 >= x1 || y0 >= y1)
+        return;
+
+    for (int x = x0; x < x1; x++) {
+        uint32_t *p = g_fb + (g_width - x) * g_stride + y0;
+        for (int n = y1 - y0; n > 0; n--)
+            *p++ = color;
+    }
+}
+
+void fb_fill_rect(int x, int y, int w, int h, uint32_t color) {
+    fill_surface(x >> g_shift, y >> g_shift, (x + w) >> g_shift, (y + h) >> g_shift, color);
+}
+
+static fb_rect_t surface_rect(int x, int y, int w, int h) {
+    fb_rect_t r = { x >> g_shift, y >> g_shift, (x + w) >> g_shift, (y + h) >> g_shift };
+    return r;
+}
+
+fb_rect_t fb_draw_bitmap(const char *bitmap, int x, int y, int cell, uint32_t fg, uint32_t bg) {
+    int cols = 0;
+    int rows = 0;
+
+    for (const char *line = bitmap; *line; rows++) {
+        int len = strcspn(line, "\n");
+        if (len > cols)
+            cols = len;
+        line += len;
+        if (*line)
+            line++;
+    }
+
+    /* Each row goes out as runs of equal cells, short rows are padded with bg. */
+    const char *line = bitmap;
+    for (int row = 0; row < rows; row++) {
+        int len = strcspn(line, "\n");
+        int start = 0;
+        uint32_t run = (len > 0 && line[0] == 'O') ? fg : bg;
+
+        for (int col = 1; col <= cols; col++) {
+            uint32_t color = (col < len && line[col] == 'O') ? fg : bg;
+            if (col == cols || color != run) {
+                fb_fill_rect(x + start * cell, y + row * cell, (col - start) * cell, cell, run);
+                start = col;
+                run = color;
+            }
+        }
+
+        line += len;
+        if (*line)
+            line++;
+    }
+
+    return surface_rect(x, y, cols * cell, rows * cell);
+}
+
+fb_rect_t fb_draw_text(const char *text, int x, int y, int scale, uint32_t fg, uint32_t bg) {
+    int font_w, font_h;
+    const unsigned char *font = video_get_font(&font_w, &font_h);
+    int width_bytes = (font_w + 7) / 8;
+    int pixels = strlen(text) * font_w;
+
+    /* Any smaller and fb_fill_rect() drops whole rows and columns of the glyphs on a scaled surface. */
+    if (scale < (1 << g_shift))
+        scale = 1 << g_shift;
+
+    for (int row = 0; row < font_h; row++) {
+        int start = 0;
+        uint32_t run = bg;
+
+        for (int px = 0; px <= pixels; px++) {
+            uint32_t color = bg;
+            if (px < pixels) {
+                const unsigned char *glyph = font + (unsigned char)text[px / font_w] * font_h * width_bytes;
+                int bit = px % font_w;
+                if (glyph[row * width_bytes + bit / 8] & (0x80 >> (bit & 7)))
+                    color = fg;
+            }
+
+            if (px == 0) {
+                run = color;
+            } else if (px == pixels || color != run) {
+                fb_fill_rect(x + start * scale, y + row * scale, (px - start) * scale, scale, run);
+                start = px;
+                run = color;
+            }
+        }
+    }
+
+    return surface_rect(x, y, pixels * scale, font_h * scale);
+}
+
+void fb_clear_except(const fb_rect_t *keep, int count, uint32_t color) {
+    fb_rect_t spans[FB_MAX_KEEP];
+
+    if (count > FB_MAX_KEEP)
+        count = FB_MAX_KEEP;
+
+    for (int x = 1; x <= g_width; x++) {
+        /* Rects crossing this column, sorted by top edge. */
+        int n = 0;
+        for (int i = 0; i < count; i++) {
+            if (x < keep[i].x0 || x >= keep[i].x1)
+                continue;
+            int j = n++;
+            while (j > 0 && spans[j - 1].y0 > keep[i].y0) {
+                spans[j] = spans[j - 1];
+                j--;
+            }
+            spans[j] = keep[i];
+        }
+
+        int y = 0;
+        for (int i = 0; i < n; i++) {
+            if (spans[i].y0 > y)
+                fill_surface(x, y, x + 1, spans[i].y0, color);
+            if (spans[i].y1 > y)
+                y = spans[i].y1;
+        }
+        fill_surface(x, y, x + 1, g_height, color);
+    }
+}
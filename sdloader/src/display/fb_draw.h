@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2022 HWFLY-NX
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FUSEE_FB_DRAW_H
+#define FUSEE_FB_DRAW_H
+
+#include <stdint.h>
+
+/*
+ * Landscape drawing on the panel's portrait framebuffer, optionally scaled down by 1 << shift.
+ * Coordinates are full resolution landscape pixels (1280x720). A screen column is one
+ * contiguous framebuffer line, so everything is filled as vertical spans.
+ */
+
+typedef struct {
+    int x0, y0, x1, y1; /* Surface pixels, exclusive end. */
+} fb_rect_t;
+
+void fb_draw_init(void *fb, uint32_t shift);
+void fb_fill_rect(int x, int y, int w, int h, uint32_t color);
+
+/* Bitmap of '\n' separated rows, 'O' is fg and anything else bg. Paints its whole bounding box. */
+fb_rect_t fb_draw_bitmap(const char *bitmap, int x, int y, int cell, uint32_t fg, uint32_t bg);
+
+/* One line of text in the console font, scale pixels per font pixel but at least one surface pixel. Paints its whole bounding box. */
+fb_rect_t fb_draw_text(const char *text, int x, int y, int scale, uint32_t fg, uint32_t bg);
+
+/* Fill everything outside the given rects, so nothing is painted twice. */
+void fb_clear_except(const fb_rect_t *keep, int count, uint32_t color);
+
+#endif
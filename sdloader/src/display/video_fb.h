@@ -50,8 +50,13 @@
 int video_get_col(void);
 int video_get_row(void);
 
+/* Console font, height rows of (width + 7) / 8 bytes per glyph, MSB is the leftmost pixel. */
+const unsigned char *video_get_font(int *width, int *height);
+
+/* fb holds two screens (2 * 1280 * 768 * 4 bytes), the console scrolls through them as a ring. */
 int video_init(void *fb);
 int video_resume(void *fb, int row, int col);
+void video_putc(const char c);
 void video_puts(const char *s);
 
 #endif /*_VIDEO_FB_H_ */
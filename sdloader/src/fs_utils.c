@@ -47,10 +47,15 @@ bool mount_sd(void)
             g_sd_initialized = true;
 
             /* Mount SD. */
-            if (f_mount(&sd_fs, "", 1) == FR_OK) {
-                //print(SCREEN_LOG_LEVEL_INFO, "Mounted SD card!\n");
+            FRESULT res = f_mount(&sd_fs, "", 1);
+            if (res == FR_OK) {
+                print(SCREEN_LOG_LEVEL_INFO, "Mounted SD card!\n");
                 g_sd_mounted = true;
+            } else {
+                print(SCREEN_LOG_LEVEL_ERROR, "Failed to mount SD card (FatFs error %d)!\n", res);
             }
+        } else {
+            print(SCREEN_LOG_LEVEL_ERROR, "Failed to initialize SD card!\n");
         }
     }
 
@@ -115,6 +120,52 @@ int read_from_file(void *dst, uint32_t dst_size, const char *filename)
     return (res == FR_OK) ? (int)br : 0;
 }
 
+int read_from_file_chunked(void *dst, uint32_t dst_size, const char *filename, uint32_t chunk_size, read_chunk_callback_t callback)
+{
+    read_extent_t extent = { dst, dst_size };
+    return read_from_file_extents(&extent, 1, filename, chunk_size, callback);
+}
+
+int read_from_file_extents(const read_extent_t *extents, uint32_t num_extents, const char *filename, uint32_t chunk_size, read_chunk_callback_t callback)
+{
+    /* SD card hasn't been mounted yet. */
+    if (!g_sd_mounted)
+        return 0;
+
+    /* Open the file for reading. */
+    FIL f;
+    if (f_open(&f, filename, FA_READ) != FR_OK)
+        return 0;
+
+    /* Read from file, handing every chunk over as soon as it has landed. */
+    uint32_t total = 0;
+    int res = FR_OK;
+    for (uint32_t i = 0; i < num_extents && res == FR_OK; i++) {
+        uint8_t *dst8 = (uint8_t *)extents[i].dst;
+        uint32_t done = 0;
+        while (done < extents[i].size) {
+            UINT br = 0;
+            uint32_t to_read = (extents[i].size - done) < chunk_size ? (extents[i].size - done) : chunk_size;
+            res = f_read(&f, dst8 + done, to_read, &br);
+            if (res != FR_OK || br == 0) {
+                print(SCREEN_LOG_LEVEL_ERROR, "Failed to read %s at 0x%x (FatFs error %d)!\n", filename, total, res);
+                break;
+            }
+
+            callback(dst8 + done, br, total);
+            done += br;
+            total += br;
+        }
+
+        /* A short file, the caller sees it in the total. */
+        if (done != extents[i].size)
+            break;
+    }
+    f_close(&f);
+
+    return (res == FR_OK) ? (int)total : 0;
+}
+
 int write_to_file(void *src, uint32_t src_size, const char *filename)
 {
     /* SD card hasn't been mounted yet. */
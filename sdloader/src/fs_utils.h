@@ -23,6 +23,14 @@
 #include "sdmmc/sdmmc.h"
 #include "utils.h"
 
+typedef void (*read_chunk_callback_t)(const void *chunk, uint32_t chunk_size, uint32_t offset);
+
+/* Where one consecutive part of a file goes. Chunks never straddle two extents. */
+typedef struct {
+    void *dst;
+    uint32_t size;
+} read_extent_t;
+
 extern sdmmc_t g_sd_sdmmc;
 extern sdmmc_device_t g_sd_device;
 
@@ -30,6 +38,8 @@ bool mount_sd(void);
 void unmount_sd(void);
 uint32_t get_file_size(const char *filename);
 int read_from_file(void *dst, uint32_t dst_size, const char *filename);
+int read_from_file_chunked(void *dst, uint32_t dst_size, const char *filename, uint32_t chunk_size, read_chunk_callback_t callback);
+int read_from_file_extents(const read_extent_t *extents, uint32_t num_extents, const char *filename, uint32_t chunk_size, read_chunk_callback_t callback);
 int write_to_file(void *src, uint32_t src_size, const char *filename);
 
 #endif
@@ -3897,8 +3897,22 @@ FRESULT f_read (
 			sect += csect;
 			cc = btr / SS(fs);					/* When remaining bytes >= sector size, */
 			if (cc > 0) {						/* Read maximum contiguous sectors directly */
-				if (csect + cc > fs->csize) {	/* Clip at cluster boundary */
-					cc = fs->csize - csect;
+				if (csect + cc > fs->csize) {	/* Clip at the end of the contiguous cluster run */
+					UINT run = fs->csize - csect;
+					while (run < cc) {			/* Extend over following clusters while they are adjacent */
+#if FF_USE_FASTSEEK
+						if (fp->cltbl) {
+							clst = clmt_clust(fp, fp->fptr + (FSIZE_t)run * SS(fs));
+						} else
+#endif
+						{
+							clst = get_fat(&fp->obj, fp->clust);
+						}
+						if (clst != fp->clust + 1) break;	/* Fragment boundary, end of chain or error is handled by the next round */
+						fp->clust = clst;
+						run += fs->csize;
+					}
+					if (cc > run) cc = run;
 				}
 				if (disk_read(fs->pdrv, rbuff, sect, cc) != RES_OK) ABORT(fs, FR_DISK_ERR);
 #if !FF_FS_READONLY && FF_FS_MINIMIZE <= 2		/* Replace one of the read sectors with cached data if it contains a dirty sector */
@@ -16,12 +16,24 @@
 
 #include "log.h"
 
+#include "../utils.h"
 #include "../display/video_fb.h"
 #include "vsprintf.h"
 
+#ifdef CONFIG_LOG_UART
+#include "../uart.h"
+#include "../car.h"
+#endif
+
 /* default log level for screen output */
 ScreenLogLevel g_screen_log_level = SCREEN_LOG_LEVEL_NONE;
 
+/* Captured messages, oldest first starting at g_log_ring_pos once it wrapped. */
+static char g_log_ring[LOG_RING_SIZE] __attribute__((section(".low_iram_bss")));
+static size_t g_log_ring_pos;
+static bool g_log_ring_wrapped;
+static bool g_log_on_screen;
+
 void log_set_log_level(ScreenLogLevel log_level) {
     g_screen_log_level = log_level;
 }
@@ -31,42 +43,112 @@ ScreenLogLevel log_get_log_level() {
 }
 
 void log_to_uart(const char *message) {
-    /* TODO: add UART logging */
+#ifdef CONFIG_LOG_UART
+    static const CarDevice uart_clk[] = { CARDEVICE_UARTA, CARDEVICE_UARTB, CARDEVICE_UARTC };
+    static bool uart_ready;
+
+    /* Only bring up the port once there's something to send. */
+    if (!uart_ready) {
+        uart_config(CONFIG_LOG_UART);
+        clkrst_reboot(uart_clk[CONFIG_LOG_UART]);
+        uart_init(CONFIG_LOG_UART, BAUD_115200);
+        uart_ready = true;
+    }
+
+    uart_send(CONFIG_LOG_UART, message, strlen(message));
+#else
+    (void)message;
+#endif
+}
+
+static void log_to_ring(const char *message) {
+    while (*message) {
+        g_log_ring[g_log_ring_pos++] = *message++;
+        if (g_log_ring_pos == LOG_RING_SIZE) {
+            g_log_ring_pos = 0;
+            g_log_ring_wrapped = true;
+        }
+    }
+}
+
+bool log_is_captured(ScreenLogLevel screen_log_level) {
+    screen_log_level &= ~SCREEN_LOG_LEVEL_NO_PREFIX;
+    return screen_log_level <= LOG_RING_LEVEL || screen_log_level <= g_screen_log_level;
+}
+
+bool log_has_messages(void) {
+    return g_log_ring_pos != 0 || g_log_ring_wrapped;
 }
 
-#if 0
 static void print_to_screen(ScreenLogLevel screen_log_level, char *message) {
     /* don't print to screen if below log level */
     if(screen_log_level > g_screen_log_level) return;
 
+    /* The console is only brought up by the first message that is really shown. */
+    if (!g_log_on_screen) {
+        console_init();
+        g_log_on_screen = true;
+    }
+
     video_puts(message);
 }
-#endif
+
+void log_flush_to_screen(void) {
+    if (g_screen_log_level < LOG_RING_LEVEL)
+        g_screen_log_level = LOG_RING_LEVEL;
+
+    /* Whatever reached the screen before was shown as it happened, don't repeat it. */
+    if (g_log_on_screen)
+        return;
+
+    console_init();
+    g_log_on_screen = true;
+
+    if (g_log_ring_wrapped) {
+        /* The oldest line was partly overwritten, start at the next complete one. */
+        size_t pos = g_log_ring_pos;
+        while (pos < LOG_RING_SIZE && g_log_ring[pos++] != '\n') { }
+
+        video_puts("...\n");
+        for (; pos < LOG_RING_SIZE; pos++)
+            video_putc(g_log_ring[pos]);
+    }
+
+    for (size_t pos = 0; pos < g_log_ring_pos; pos++)
+        video_putc(g_log_ring[pos]);
+}
+
+static void log_message(ScreenLogLevel screen_log_level, char *message) {
+    /* log to UART */
+    log_to_uart(message);
+
+    log_to_ring(message);
+
+    print_to_screen(screen_log_level, message);
+}
 
 /**
  * vprintk - logs a message and prints it to screen based on its screen_log_level
  *
  * If the level is below g_screen_log_level it will not be shown but logged to UART
  * This text will not be colored or prefixed
- * UART is TODO
  */
 void vprint(ScreenLogLevel screen_log_level, const char *fmt, va_list args)
 {
-#if 0
     char buf[PRINT_MESSAGE_MAX_LENGTH];
+
+    /* Normal boots don't pay for formatting messages nobody will see. */
+    if (!log_is_captured(screen_log_level))
+        return;
+
     vsnprintf(buf, PRINT_MESSAGE_MAX_LENGTH, fmt, args);
 
     /* we don't need that flag here, but if it gets used, strip it so we print correctly */
     screen_log_level &= ~SCREEN_LOG_LEVEL_NO_PREFIX;
 
-    /* log to UART */
-    log_to_uart(buf);
-
-    print_to_screen(screen_log_level, buf);
-#endif
+    log_message(screen_log_level, buf);
 }
 
-#if 0
 static void add_prefix(ScreenLogLevel screen_log_level, const char *fmt, char *buf) {
     char typebuf[] = "[%s] %s";
 
@@ -93,23 +175,21 @@ static void add_prefix(ScreenLogLevel screen_log_level, const char *fmt, char *b
             break;
     }
 }
-#endif
 
 /**
  * print - logs a message and prints it to screen based on its screen_log_level
  * 
  * If the level is below g_screen_log_level it will not be shown but logged to UART
  * Use SCREEN_LOG_LEVEL_NO_PREFIX if you don't want a prefix to be added
- * UART is TODO
  */
 void print(ScreenLogLevel screen_log_level, const char * fmt, ...)
 {
-#if 0
+    if (!log_is_captured(screen_log_level))
+        return;
+
     char buf[PRINT_MESSAGE_MAX_LENGTH] = {};
     char message[PRINT_MESSAGE_MAX_LENGTH] = {};
 
-    /* TODO: make splash disappear if level > MANDATORY */
-
     /* make prefix free messages with log_level possible */
     if(screen_log_level & SCREEN_LOG_LEVEL_NO_PREFIX) {
         /* remove the NO_PREFIX flag so the enum can be recognized later on */
@@ -127,9 +207,5 @@ void print(ScreenLogLevel screen_log_level, const char * fmt, ...)
     vsnprintf(message, PRINT_MESSAGE_MAX_LENGTH, buf, args);
     va_end(args);
 
-    /* log to UART */
-    log_to_uart(message);
-
-    print_to_screen(screen_log_level, message);
-#endif
-}
\ No newline at end of file
+    log_message(screen_log_level, message);
+}
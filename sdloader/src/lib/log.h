@@ -19,7 +19,12 @@
 
 #define PRINT_MESSAGE_MAX_LENGTH 1024
 
+/* Messages up to LOG_RING_LEVEL are kept in a RAM ring, so an error path can show what led to it. */
+#define LOG_RING_SIZE   0x1000
+#define LOG_RING_LEVEL  SCREEN_LOG_LEVEL_WARNING
+
 #include <stdarg.h>
+#include <stdbool.h>
 
 typedef enum {
     SCREEN_LOG_LEVEL_NONE       = 0,
@@ -37,7 +42,11 @@ extern ScreenLogLevel g_screen_log_level;
 void log_set_log_level(ScreenLogLevel screen_log_level);
 ScreenLogLevel log_get_log_level();
 void log_to_uart(const char *message);
+bool log_is_captured(ScreenLogLevel screen_log_level);
+bool log_has_messages(void);
+/* Brings up the console, replays the ring and keeps printing captured messages from then on. */
+void log_flush_to_screen(void);
 void vprint(ScreenLogLevel screen_log_level, const char *fmt, va_list args);
 void print(ScreenLogLevel screen_log_level, const char* fmt, ...);
 
-#endif
\ No newline at end of file
+#endif
@@ -77,6 +77,8 @@
 * marcus.geelnard at home.se
 *************************************************************************/
 
+#include <stdint.h>
+#include "lz.h"
 
 /*************************************************************************
 * Constants used for LZ77 coding
@@ -154,14 +156,21 @@ static int _LZ_ReadVarSize( unsigned int * x, const unsigned char * buf )
 {
     unsigned int y, b, num_bytes;
 
+    /* Most lengths and short offsets fit in a single byte */
+    b = (unsigned int) buf[ 0 ];
+    if( !(b & 0x00000080) )
+    {
+        *x = b;
+        return 1;
+    }
+
     /* Read complete value (stop when byte contains zero in 8:th bit) */
-    y = 0;
-    num_bytes = 0;
+    y = b & 0x0000007f;
+    num_bytes = 1;
     do
     {
-        b = (unsigned int) (*buf ++);
+        b = (unsigned int) buf[ num_bytes ++ ];
         y = (y << 7) | (b & 0x0000007f);
-        ++ num_bytes;
     }
     while( b & 0x00000080 );
 
@@ -173,6 +182,44 @@ static int _LZ_ReadVarSize( unsigned int * x, const unsigned char * buf )
 }
 
 
+/*************************************************************************
+* _LZ_CopyMatch() - Copy a string from the history window. Offsets that
+* are a multiple of four keep source and destination equally aligned and
+* never overlap within a word, so those are copied a word at a time
+* (HWFLY-NX addition).
+*************************************************************************/
+
+typedef unsigned int __attribute__((may_alias)) lz_word_t;
+
+static unsigned char * _LZ_CopyMatch( unsigned char * dst, unsigned int length,
+    unsigned int offset )
+{
+    const unsigned char *src = dst - offset;
+
+    if( (length >= 8) && !(offset & 3) )
+    {
+        while( (uintptr_t) dst & 3 )
+        {
+            *dst ++ = *src ++;
+            -- length;
+        }
+        for( ; length >= 4; length -= 4 )
+        {
+            *(lz_word_t *) dst = *(const lz_word_t *) src;
+            dst += 4;
+            src += 4;
+        }
+    }
+
+    while( length -- )
+    {
+        *dst ++ = *src ++;
+    }
+
+    return dst;
+}
+
+
 
 /*************************************************************************
 *                            PUBLIC FUNCTIONS                            *
@@ -323,9 +370,29 @@ int LZ_Compress( const unsigned char *in, unsigned char *out, unsigned int insiz
 *************************************************************************/
 
 int LZ_Uncompress( const unsigned char *in, unsigned char *out, unsigned int insize )
+{
+    return LZ_UncompressDict( in, out, insize, 0 );
+}
+
+
+/*************************************************************************
+* LZ_UncompressDict() - Uncompress a block of data that was compressed
+* with a preset dictionary (HWFLY-NX addition).
+*  in       - Input (compressed) buffer.
+*  out      - Output buffer. The first dictsize bytes must hold the
+*             dictionary, the uncompressed data is written after it.
+*  insize   - Number of input bytes.
+*  dictsize - Number of dictionary bytes in front of the output.
+* The function returns the number of uncompressed bytes, excluding the
+* dictionary.
+*************************************************************************/
+
+int LZ_UncompressDict( const unsigned char *in, unsigned char *out, unsigned int insize, unsigned int dictsize )
 {
     unsigned char marker, symbol;
-    unsigned int  i, inpos, outpos, length, offset;
+    unsigned int  length, offset;
+    const unsigned char *inend;
+    unsigned char *dst;
 
     /* Do we have anything to uncompress? */
     if( insize < 1 )
@@ -334,44 +401,35 @@ int LZ_Uncompress( const unsigned char *in, unsigned char *out, unsigned int ins
     }
 
     /* Get marker symbol from input stream */
-    marker = in[ 0 ];
-    inpos = 1;
+    marker = *in ++;
+    inend = in + insize - 1;
 
     /* Main decompression loop */
-    outpos = 0;
-    do
+    dst = out + dictsize;
+    while( in < inend )
     {
-        symbol = in[ inpos ++ ];
-        if( symbol == marker )
+        symbol = *in ++;
+        if( symbol != marker )
         {
-            /* We had a marker byte */
-            if( in[ inpos ] == 0 )
-            {
-                /* It was a single occurrence of the marker byte */
-                out[ outpos ++ ] = marker;
-                ++ inpos;
-            }
-            else
-            {
-                /* Extract true length and offset */
-                inpos += _LZ_ReadVarSize( &length, &in[ inpos ] );
-                inpos += _LZ_ReadVarSize( &offset, &in[ inpos ] );
-
-                /* Copy corresponding data from history window */
-                for( i = 0; i < length; ++ i )
-                {
-                    out[ outpos ] = out[ outpos - offset ];
-                    ++ outpos;
-                }
-            }
+            /* No marker, plain copy */
+            *dst ++ = symbol;
+        }
+        else if( *in == 0 )
+        {
+            /* It was a single occurrence of the marker byte */
+            *dst ++ = marker;
+            ++ in;
         }
         else
         {
-            /* No marker, plain copy */
-            out[ outpos ++ ] = symbol;
+            /* Extract true length and offset */
+            in += _LZ_ReadVarSize( &length, in );
+            in += _LZ_ReadVarSize( &offset, in );
+
+            /* Copy corresponding data from history window */
+            dst = _LZ_CopyMatch( dst, length, offset );
         }
     }
-    while( inpos < insize );
 
-    return outpos;
+    return (int) (dst - out) - dictsize;
 }
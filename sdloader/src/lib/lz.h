@@ -43,6 +43,7 @@ extern "C" {
 
 int LZ_Compress(const unsigned char *in, unsigned char *out, unsigned int insize);
 int LZ_Uncompress(const unsigned char *in, unsigned char *out, unsigned int insize);
+int LZ_UncompressDict(const unsigned char *in, unsigned char *out, unsigned int insize, unsigned int dictsize);
 
 #ifdef __cplusplus
 }
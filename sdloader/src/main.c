@@ -25,30 +25,45 @@
 #include "lib/log.h"
 #include "lib/vsprintf.h"
 #include "display/video_fb.h"
+#include "display/fb_draw.h"
 #include "btn.h"
 #include "fuse.h"
 #include "sdram.h"
 #include "sdmmc/mmc.h"
+#include "payload_load.h"
+#include "boot_config.h"
 
 extern void (*__program_exit_callback)(int rc);
 
+/* Error screens use a 1/8 scale surface in the (then unused) payload area past sdloader, so DRAM isn't needed. */
+#define SMALL_FB_ADDRESS    0x40021000
+#define SMALL_FB_SHIFT      3
+
 static void *g_framebuffer;
+static uint32_t g_fb_shift;
 
 static sdmmc_t emmc_sdmmc;
 
-static void setup_display(void) {
-    sdram_init();
+static void setup_display(bool full_res) {
+    if (full_res) {
+        /* DRAM is only trained once a full resolution surface is really needed. */
+        sdram_init();
 
-    g_framebuffer = (void *) 0xC0000000;
+        g_framebuffer = (void *) 0xC0000000;
+        g_fb_shift = 0;
 
-    /* Zero-fill the framebuffer and register it as printk provider. */
-    video_init(g_framebuffer);
+        /* Zero-fill the framebuffer and register it as printk provider. */
+        video_init(g_framebuffer);
+    } else {
+        g_framebuffer = (void *) SMALL_FB_ADDRESS;
+        g_fb_shift = SMALL_FB_SHIFT;
+    }
 
     /* Initialize the display. */
     display_init();
 
     /* Set the framebuffer. */
-    display_init_framebuffer(g_framebuffer);
+    display_init_framebuffer_scaled(g_framebuffer, g_fb_shift);
 }
 
 static void exit_callback(int rc) {
@@ -57,76 +72,6 @@ static void exit_callback(int rc) {
     power_off();
 }
 
-static int load_payload(const char *path) {
-    FILINFO info;
-    size_t size;
-
-    /* Check if the binary is present. */
-    if (f_stat(path, &info) != FR_OK) {
-        //print(1, "Payload not found!\n");
-        return -2;
-    }
-
-    size = (size_t)info.fsize;
-
-    if (size > 0x1F000)
-        return -3;
-
-    /* Try to read the binary. */
-    if (read_from_file((void *)0x40021000, size, path) != size) {
-        //print(SCREEN_LOG_LEVEL_WARNING, "Failed to read payload (%s)!\n", path);
-        return -2;
-    }
-
-    g_chainloader_entry.src_address  = 0x40021000;
-    g_chainloader_entry.size         = size;
-
-    return 0;
-}
-
-static void draw_square(int off_x, int off_y, int x, int y, int multi, int color)
-{
-    int start_x = off_x + (x * multi);
-    int start_y = off_y + (y * multi);
-    uint32_t *fb = (uint32_t *) g_framebuffer;
-#define fb_coord(x, y) (fb[(y) + (1280 - (x)) * (720 + 48)])
-    
-    for (int i = 0; i < multi; i++)
-        for (int j = 0; j < multi; j++)
-            if (start_y + j > 0 && start_y + j < 720)
-                fb_coord(start_x + i, start_y + j) = color;
-}
-
-static void draw_table(const char *msg, int off_x, int off_y, int size)
-{    
-    int x = 0;
-    int y = 0;
-    
-    for (int i = 0; i < strlen(msg); i++)
-    {
-        if (msg[i] == '\n')
-        {
-            x = 0;
-            ++y;
-            continue;
-        }
-        
-        if (msg[i] != '*')
-        {
-            int color = 0xFFFFFF;
-            switch(msg[i])
-            {
-                // Only Black & White
-                case ' ': color = 0x000000; break;
-                case 'O': color = 0xFFFFFF; break;
-            }
-            draw_square(off_x, off_y, x, y, size, color);
-        }
-        
-        ++x;
-    }
-}
-
 const char *no_sd =
     "O   O OOOOO  OOOOO OOOO \n"
     "OO  O O   O  O     O   O\n"
@@ -151,6 +96,14 @@ const char *no_bin =
     "O   O OOOOO  OOOO  OOO O   O\n"
 ;
 
+const char *bad_bin =
+    "OOOO   OOO  OOOO   OOOO  OOO O   O\n"
+    "O   O O   O O   O  O   O  O  OO  O\n"
+    "OOOO  OOOOO O   O  OOOO   O  O O O\n"
+    "O   O O   O O   O  O   O  O  O  OO\n"
+    "OOOO  O   O OOOO   OOOO  OOO O   O\n"
+;
+
 static void modchip_send(sdmmc_t *sdmmc, uint8_t *buf)
 {
     sdmmc_command_t cmd = {};
@@ -218,24 +171,66 @@ int main(void) {
 	
     autohosoff();
 
+    const char *payload_path = BOOT_CONFIG_DEFAULT_PAYLOAD;
     if (ret == 0)
     {
-		ret = load_payload("payload.bin");
+        payload_path = boot_config_get_payload(btn);
+		ret = load_payload(payload_path);
     }
 
     if (ret != 0)
     {
-        setup_display();
+        /* A flaky card is worth knowing about, even when it wasn't what failed. */
+        if (g_sd_device.stats.retries)
+            print(SCREEN_LOG_LEVEL_WARNING, "SD: %u retries, %u CRC errors, %u timeouts, %u speed downgrades, bus mode %d\n",
+                g_sd_device.stats.retries, g_sd_device.stats.crc_errors, g_sd_device.stats.timeouts, g_sd_device.stats.speed_downgrades,
+                g_sd_device.bus_speed);
+
+        setup_display(false);
 
-        memset(g_framebuffer, 0x00, (720 + 48) * 1280 * 4);
+        /* Paint the message, then clear only what's left around it. */
+        fb_rect_t painted[3];
+        int num_painted = 0;
+        fb_draw_init(g_framebuffer, g_fb_shift);
 
         if (ret == -1)
-            draw_table(no_sd, 50, 50, 50);
+            painted[num_painted++] = fb_draw_bitmap(no_sd, 50, 50, 50, 0xFFFFFF, 0x000000);
         else if (ret == -2)
-            draw_table(no_bin, 52, 52, 42);
+            painted[num_painted++] = fb_draw_bitmap(no_bin, 52, 52, 42, 0xFFFFFF, 0x000000);
         else if (ret == -3)
-            draw_table(big_bin, 48, 48, 37);
-        else if (ret == 1)
+            painted[num_painted++] = fb_draw_bitmap(big_bin, 48, 48, 37, 0xFFFFFF, 0x000000);
+        else if (ret == -4)
+            painted[num_painted++] = fb_draw_bitmap(bad_bin, 45, 45, 35, 0xFFFFFF, 0x000000);
+
+        /* Name the file the payload errors are about, as big as it fits. Below one surface pixel per
+           font pixel it would be illegible, so long paths keep their tail instead. */
+        if (ret <= -2 && ret >= -4) {
+            char path_text[BOOT_CONFIG_PATH_MAX + 4];
+            int min_scale = 1 << g_fb_shift;
+            size_t max_chars = (1280 - 2 * 48) / (8 * min_scale);
+            size_t len = strlen(payload_path);
+            if (max_chars > sizeof(path_text) - 1)
+                max_chars = sizeof(path_text) - 1;
+            if (len > max_chars)
+                snprintf(path_text, sizeof(path_text), "...%s", payload_path + len - (max_chars - 3));
+            else
+                snprintf(path_text, sizeof(path_text), "%s", payload_path);
+
+            int scale = len ? (1280 - 2 * 48) / (strlen(path_text) * 8) : 8;
+            if (scale > 8)
+                scale = 8;
+            if (scale < min_scale)
+                scale = min_scale;
+            painted[num_painted++] = fb_draw_text(path_text, 48, 400, scale, 0xA0A0A0, 0x000000);
+        }
+
+        /* The log has the details, point at them. */
+        if (ret < 0 && log_has_messages())
+            painted[num_painted++] = fb_draw_text("VOL- for details", 48, 560, 8, 0xA0A0A0, 0x000000);
+
+        fb_clear_except(painted, num_painted, 0x000000);
+
+        if (ret == 1)
         {
             sdmmc_finish(&emmc_sdmmc);
             unmount_sd();
@@ -244,11 +239,22 @@ int main(void) {
 
         display_backlight(true);
 
+        /* The buttons picking the payload may still be held, only react to fresh presses. */
+        while (btn_read() & (BTN_VOL_UP | BTN_VOL_DOWN))
+            ;
+
         while (true)
         {
             uint32_t btn = btn_read();
             if (btn & BTN_POWER)
                 break;
+            /* Swap the error screen for the full log, once. */
+            if (btn == BTN_VOL_DOWN && log_has_messages() && log_get_log_level() == SCREEN_LOG_LEVEL_NONE)
+            {
+                display_end();
+                log_flush_to_screen();
+                print(SCREEN_LOG_LEVEL_ERROR | SCREEN_LOG_LEVEL_NO_PREFIX, "\nPress POWER to power off\n");
+            }
 			if (btn & BTN_VOL_UP && btn & BTN_VOL_DOWN)
 			{
 				sdmmc_finish(&emmc_sdmmc);
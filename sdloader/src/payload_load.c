@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2022 HWFLY-NX
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "utils.h"
+#include "fs_utils.h"
+#include "chainloader.h"
+#include "sdram.h"
+#include "payload_verify.h"
+#include "payload_load.h"
+#include "lib/fatfs/ff.h"
+#include "lib/log.h"
+
+int load_payload(const char *path) {
+    FILINFO info;
+    FRESULT res;
+    size_t size;
+
+    /* Check if the binary is present. */
+    if ((res = f_stat(path, &info)) != FR_OK) {
+        print(SCREEN_LOG_LEVEL_ERROR, "Payload not found (%s, FatFs error %d)!\n", path, res);
+        return -2;
+    }
+
+    size = (size_t)info.fsize;
+
+    if (size > PAYLOAD_MAX_SIZE) {
+        print(SCREEN_LOG_LEVEL_ERROR, "Payload is too big (%s, 0x%x > 0x%x bytes)!\n", path, size, PAYLOAD_MAX_SIZE);
+        return -3;
+    }
+
+    /* Load the expected hash/signature, if any. */
+    if (!payload_verify_init(path, size)) {
+        print(SCREEN_LOG_LEVEL_ERROR, "Missing or malformed hash/signature for %s!\n", path);
+        return -4;
+    }
+
+    read_extent_t extents[2];
+    uint32_t num_extents;
+    uintptr_t staging;
+    size_t staged_size;
+
+    if (size > PAYLOAD_IRAM_MAX_SIZE) {
+        /* Doesn't fit next to us, so the chainloader will have to copy all of it. */
+        sdram_init();
+        staging = PAYLOAD_DRAM_STAGING;
+        staged_size = size;
+
+        extents[0] = (read_extent_t){ (void *)staging, size };
+        num_extents = 1;
+    } else {
+        /* Split at a SHA block boundary past our .bss, so every chunk but the last stays whole blocks. */
+        extern uint8_t __end__[];
+        staging = PAYLOAD_HEAD_STAGING;
+        staged_size = ((uintptr_t)__end__ - PAYLOAD_ADDRESS + 0x3F) & ~0x3F;
+        if (staged_size > size)
+            staged_size = size;
+
+        extents[0] = (read_extent_t){ (void *)staging, staged_size };
+        extents[1] = (read_extent_t){ (void *)(PAYLOAD_ADDRESS + staged_size), size - staged_size };
+        num_extents = 2;
+    }
+
+    /* Try to read the binary, hashing each chunk while the next one is read. */
+    if (read_from_file_extents(extents, num_extents, path, PAYLOAD_VERIFY_CHUNK_SIZE, payload_verify_chunk) != size) {
+        print(SCREEN_LOG_LEVEL_ERROR, "Failed to read payload (%s)!\n", path);
+        payload_verify_finish();
+        return -2;
+    }
+
+    if (!payload_verify_finish()) {
+        print(SCREEN_LOG_LEVEL_ERROR, "Payload failed verification (%s)!\n", path);
+        return -4;
+    }
+
+    g_chainloader_entry.src_address  = staging;
+    g_chainloader_entry.size         = staged_size;
+
+    return 0;
+}
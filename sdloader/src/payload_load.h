@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2022 HWFLY-NX
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FUSEE_PAYLOAD_LOAD_H
+#define FUSEE_PAYLOAD_LOAD_H
+
+#include "utils.h"
+
+/*
+ * Payloads run from PAYLOAD_ADDRESS, where sdloader itself still is. Everything past our
+ * end is read straight into place; only the head is staged above the largest payload and
+ * copied down by the chainloader.
+ */
+#define PAYLOAD_ADDRESS         0x40010000
+#define PAYLOAD_IRAM_MAX_SIZE   0x1F000
+#define PAYLOAD_HEAD_STAGING    (PAYLOAD_ADDRESS + PAYLOAD_IRAM_MAX_SIZE)
+
+/* Anything bigger is staged whole in DRAM, clear of the console and SDMMC bounce buffer, up to the end of IRAM. */
+#define PAYLOAD_DRAM_STAGING    0xF0000000
+#define PAYLOAD_MAX_SIZE        (0x40040000 - PAYLOAD_ADDRESS)
+
+/*
+ * Reads and verifies the payload at path from the mounted SD card and sets up the chainloader.
+ * Returns 0 on success, -2 if it can't be read, -3 if it's too big, -4 if it fails verification.
+ */
+int load_payload(const char *path);
+
+#endif
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2022 HWFLY-NX
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+
+#include "utils.h"
+#include "se.h"
+#include "fs_utils.h"
+#include "payload_verify.h"
+#include "lib/vsprintf.h"
+#include "lib/fatfs/ff.h"
+
+#ifdef CONFIG_PAYLOAD_VERIFY_RSA
+/* Public modulus, built from data/payload_key.bin. */
+#include "payload_key_bin.h"
+#endif
+
+static PayloadVerifyMode g_verify_mode;
+static size_t g_verify_size;
+static size_t g_verify_hashed;
+static bool g_verify_error;
+
+/* Either the expected SHA-256 or the RSA-2048-PSS signature. */
+static uint8_t g_verify_expected[RSA_2048_BYTES];
+
+static int hex_nibble(char c) {
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+static bool load_sidecar_sha256(const char *path) {
+    char name[0x100];
+    char buf[0x40];
+
+    snprintf(name, sizeof(name), "%s" PAYLOAD_VERIFY_SHA256_EXT, path);
+    int size = read_from_file(buf, sizeof(buf), name);
+
+    /* Raw digest. */
+    if (size == 0x20) {
+        memcpy(g_verify_expected, buf, 0x20);
+        return true;
+    }
+
+    /* Hex digest, as written by sha256sum. */
+    if (size != sizeof(buf))
+        return false;
+
+    for (unsigned int i = 0; i < 0x20; i++) {
+        int hi = hex_nibble(buf[2 * i]);
+        int lo = hex_nibble(buf[2 * i + 1]);
+        if (hi < 0 || lo < 0)
+            return false;
+        g_verify_expected[i] = (uint8_t)((hi << 4) | lo);
+    }
+
+    return true;
+}
+
+#ifdef CONFIG_PAYLOAD_VERIFY_RSA
+static bool load_sidecar_sig(const char *path) {
+    char name[0x100];
+
+    snprintf(name, sizeof(name), "%s" PAYLOAD_VERIFY_SIG_EXT, path);
+    return read_from_file(g_verify_expected, RSA_2048_BYTES, name) == RSA_2048_BYTES;
+}
+#endif
+
+bool payload_verify_init(const char *path, size_t size) {
+    g_verify_mode = PAYLOAD_VERIFY_NONE;
+    g_verify_size = size;
+    g_verify_hashed = 0;
+    g_verify_error = false;
+
+#ifdef CONFIG_PAYLOAD_VERIFY_RSA
+    /* A key is built in, so every payload must be signed. */
+    if (!load_sidecar_sig(path))
+        return false;
+    g_verify_mode = PAYLOAD_VERIFY_RSA_PSS;
+#else
+    /* Only check the hash if one was provided. */
+    FILINFO info;
+    char name[0x100];
+    snprintf(name, sizeof(name), "%s" PAYLOAD_VERIFY_SHA256_EXT, path);
+    if (f_stat(name, &info) != FR_OK)
+        return true;
+    if (!load_sidecar_sha256(path))
+        return false;
+    g_verify_mode = PAYLOAD_VERIFY_SHA256;
+#endif
+
+    /* The SE can't hash an empty message in chunks. */
+    return size != 0;
+}
+
+PayloadVerifyMode payload_verify_get_mode(void) {
+    return g_verify_mode;
+}
+
+void payload_verify_chunk(const void *chunk, uint32_t chunk_size, uint32_t offset) {
+    if (g_verify_mode == PAYLOAD_VERIFY_NONE || g_verify_error)
+        return;
+
+    /* Chunks have to arrive in order and fit in the announced size. */
+    if (offset != g_verify_hashed || offset + chunk_size > g_verify_size) {
+        g_verify_error = true;
+        return;
+    }
+
+    /* Let the previous chunk finish, then hash this one while the next is being read. */
+    if (offset != 0)
+        se_wait_async_op();
+    se_sha256_chunk_start(chunk, chunk_size, g_verify_size, g_verify_size - offset);
+    g_verify_hashed += chunk_size;
+}
+
+bool payload_verify_finish(void) {
+    uint8_t hash[0x20];
+
+    if (g_verify_mode == PAYLOAD_VERIFY_NONE)
+        return true;
+
+    if (g_verify_hashed != 0)
+        se_wait_async_op();
+
+    if (g_verify_error || g_verify_hashed != g_verify_size)
+        return false;
+
+    se_sha256_get_result(hash);
+
+#ifdef CONFIG_PAYLOAD_VERIFY_RSA
+    return se_rsa2048_pss_verify_hash(g_verify_expected, RSA_2048_BYTES, payload_key_bin, RSA_2048_BYTES, hash);
+#else
+    return memcmp(hash, g_verify_expected, sizeof(hash)) == 0;
+#endif
+}
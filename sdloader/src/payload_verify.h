@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2022 HWFLY-NX
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FUSEE_PAYLOAD_VERIFY_H
+#define FUSEE_PAYLOAD_VERIFY_H
+
+#include "utils.h"
+
+/* Chunk size for streaming reads. All chunks but the last must be a multiple of the SHA block size. */
+#define PAYLOAD_VERIFY_CHUNK_SIZE   0x4000
+
+/* Sidecar files expected next to the payload, e.g. payload.bin.sha256. */
+#define PAYLOAD_VERIFY_SHA256_EXT   ".sha256"
+#define PAYLOAD_VERIFY_SIG_EXT      ".sig"
+
+typedef enum {
+    PAYLOAD_VERIFY_NONE     = 0,
+    PAYLOAD_VERIFY_SHA256   = 1,
+    PAYLOAD_VERIFY_RSA_PSS  = 2,
+} PayloadVerifyMode;
+
+/* Loads the expected hash/signature for path. Returns false if verification can't possibly succeed. */
+bool payload_verify_init(const char *path, size_t size);
+PayloadVerifyMode payload_verify_get_mode(void);
+
+/* read_chunk_callback_t: hashes chunk on the SE while the next chunk is read from SD. */
+void payload_verify_chunk(const void *chunk, uint32_t chunk_size, uint32_t offset);
+
+/* Waits for the last chunk and checks the result. */
+bool payload_verify_finish(void);
+
+#endif
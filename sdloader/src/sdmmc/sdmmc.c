@@ -26,6 +26,7 @@
 #include "mmc.h"
 #include "sd.h"
 #include "../timers.h"
+#include "../lib/log.h"
 
 #define UNSTUFF_BITS(resp,start,size)                               \
 ({                                                                  \
@@ -171,55 +172,112 @@ static int sdmmc_device_send_status(sdmmc_device_t *device)
     return sdmmc_device_send_r1_cmd(device, MMC_SEND_STATUS, (device->rca << 16), false, 0, R1_STATE_TRAN);
 }
 
+/* Retries without any progress, backing off from 1ms. */
+#define SDMMC_RW_RETRIES            10
+#define SDMMC_RW_BACKOFF_MAX_MS     128
+
+/* Blocks the controller had counted that may not have reached memory yet, transferred again on resume. */
+#define SDMMC_RW_RESUME_SLACK       2
+
+/* Consecutive CRC errors before dropping to a slower bus speed. */
+#define SDMMC_RW_CRC_DOWNGRADE      2
+
+static int sdmmc_sd_downgrade_speed(sdmmc_device_t *device);
+
 static int sdmmc_device_rw(sdmmc_device_t *device, uint32_t sector, uint32_t num_sectors, void *data, bool is_read)
 {
     uint8_t *buf = (uint8_t *)data;
     
     sdmmc_command_t cmd = {};
     sdmmc_request_t req = {};
+
+    uint32_t num_retries = SDMMC_RW_RETRIES;
+    uint32_t backoff_ms = 1;
+    uint32_t crc_errors = 0;
     
     while (num_sectors)
     {
         uint32_t num_blocks_out = 0;
-        uint32_t num_retries = 10;
         
-        for (; num_retries > 0; num_retries--)
+        cmd.opcode = is_read ? MMC_READ_MULTIPLE_BLOCK : MMC_WRITE_MULTIPLE_BLOCK;
+        cmd.arg = sector;
+        cmd.flags = SDMMC_RSP_R1;
+        
+        req.data = buf;
+        req.blksz = 512;
+        req.num_blocks = num_sectors;
+        req.is_read = is_read;
+        req.is_multi_block = true;
+        req.is_auto_cmd12 = true;
+
+        /* Try to send the command. */
+        if (sdmmc_send_cmd(device->sdmmc, &cmd, &req, &num_blocks_out))
         {
-            cmd.opcode = is_read ? MMC_READ_MULTIPLE_BLOCK : MMC_WRITE_MULTIPLE_BLOCK;
-            cmd.arg = sector;
-            cmd.flags = SDMMC_RSP_R1;
-            
-            req.data = buf;
-            req.blksz = 512;
-            req.num_blocks = num_sectors;
-            req.is_read = is_read;
-            req.is_multi_block = true;
-            req.is_auto_cmd12 = true;
-
-            /* Try to send the command. */
-            if (!sdmmc_send_cmd(device->sdmmc, &cmd, &req, &num_blocks_out))
+            /* Advance to next sector. */
+            sector += num_blocks_out;
+            num_sectors -= num_blocks_out;
+            buf += (512 * num_blocks_out);
+
+            num_retries = SDMMC_RW_RETRIES;
+            backoff_ms = 1;
+            crc_errors = 0;
+            continue;
+        }
+
+        uint32_t error = device->sdmmc->last_error;
+
+        /* Abort the transmission. */
+        sdmmc_abort(device->sdmmc, MMC_STOP_TRANSMISSION);
+        
+        /* Peek the SD card's status. */
+        sdmmc_device_send_status(device);
+
+        device->stats.retries++;
+        if (error & (TEGRA_MMC_NORINTSTS_DATA_CRC_ERR | TEGRA_MMC_NORINTSTS_CMD_CRC_ERR))
+        {
+            device->stats.crc_errors++;
+            crc_errors++;
+        }
+        else if (error & (TEGRA_MMC_NORINTSTS_DATA_TIMEOUT | TEGRA_MMC_NORINTSTS_CMD_TIMEOUT))
+            device->stats.timeouts++;
+
+        /* Resume after what made it instead of starting over. */
+        if (num_blocks_out > SDMMC_RW_RESUME_SLACK)
+        {
+            uint32_t num_blocks_done = num_blocks_out - SDMMC_RW_RESUME_SLACK;
+            sector += num_blocks_done;
+            num_sectors -= num_blocks_done;
+            buf += (512 * num_blocks_done);
+
+            num_retries = SDMMC_RW_RETRIES;
+            backoff_ms = 1;
+        }
+
+        /* The bus keeps corrupting data, slow it down. */
+        if (crc_errors >= SDMMC_RW_CRC_DOWNGRADE)
+        {
+            crc_errors = 0;
+            if (sdmmc_sd_downgrade_speed(device))
             {
-                /* Abort the transmission. */
-                sdmmc_abort(device->sdmmc, MMC_STOP_TRANSMISSION);
-                
-                /* Peek the SD card's status. */
-                sdmmc_device_send_status(device);
-
-                /* Wait for a while. */
-                mdelay(100);
+                device->stats.speed_downgrades++;
+                print(SCREEN_LOG_LEVEL_WARNING, "%s: CRC errors, lowered bus speed to mode %d\n", device->sdmmc->name, device->bus_speed);
+                continue;
             }
-            else
-                break;
         }
-        
+
         /* Failed to read/write on all attempts. */
-        if (!num_retries)
+        if (!--num_retries)
+        {
+            /* The retry counters are reported by the caller. */
+            print(SCREEN_LOG_LEVEL_ERROR, "%s: %s failed at sector %u (error 0x%08X)\n",
+                device->sdmmc->name, is_read ? "Read" : "Write", sector, error);
             return 0;
-        
-        /* Advance to next sector. */
-        sector += num_blocks_out;
-        num_sectors -= num_blocks_out;
-        buf += (512 * num_blocks_out);
+        }
+
+        /* Wait for a while, longer every time. */
+        mdelay(backoff_ms);
+        if (backoff_ms < SDMMC_RW_BACKOFF_MAX_MS)
+            backoff_ms <<= 1;
     }
     
     return 1;
@@ -733,6 +791,8 @@ static int sdmmc_sd_switch_hs_low(sdmmc_device_t *device, uint8_t *status)
         /* Run tuning. */
         if (!sdmmc_execute_tuning(device->sdmmc, SDMMC_SPEED_SD_SDR104, MMC_SEND_TUNING_BLOCK))
             return 0;
+
+        device->bus_speed = SDMMC_SPEED_SD_SDR104;
     }
     else if (status[13] & SD_MODE_UHS_SDR50)    /* High-speed SDR50 is supported. */
     {
@@ -747,6 +807,8 @@ static int sdmmc_sd_switch_hs_low(sdmmc_device_t *device, uint8_t *status)
         /* Run tuning. */
         if (!sdmmc_execute_tuning(device->sdmmc, SDMMC_SPEED_SD_SDR50, MMC_SEND_TUNING_BLOCK))
             return 0;
+
+        device->bus_speed = SDMMC_SPEED_SD_SDR50;
     }
     else if (status[13] & SD_MODE_UHS_SDR12)    /* High-speed SDR12 is supported. */
     {
@@ -761,6 +823,8 @@ static int sdmmc_sd_switch_hs_low(sdmmc_device_t *device, uint8_t *status)
         /* Run tuning. */
         if (!sdmmc_execute_tuning(device->sdmmc, SDMMC_SPEED_SD_SDR12, MMC_SEND_TUNING_BLOCK))
             return 0;
+
+        device->bus_speed = SDMMC_SPEED_SD_SDR12;
     }
     else
         return 0;
@@ -795,6 +859,48 @@ static int sdmmc_sd_switch_hs_high(sdmmc_device_t *device, uint8_t *status)
     return 1;
 }
 
+/* Steps a UHS card down SDR104 -> SDR50 -> SDR25 (high-speed at 1.8V). */
+static int sdmmc_sd_downgrade_speed(sdmmc_device_t *device)
+{
+    uint8_t status[64] __attribute__((aligned(4)));
+    uint32_t type;
+    SdmmcBusSpeed bus_speed;
+
+    switch (device->bus_speed) {
+        case SDMMC_SPEED_SD_SDR104:
+            type = UHS_SDR50_BUS_SPEED;
+            bus_speed = SDMMC_SPEED_SD_SDR50;
+            break;
+        case SDMMC_SPEED_SD_SDR50:
+            type = UHS_SDR25_BUS_SPEED;
+            bus_speed = SDMMC_SPEED_SD_SDR25;
+            break;
+        default:
+            /* Nothing slower to go to. */
+            return 0;
+    }
+
+    /* Switch the card first, then the host. */
+    if (!sdmmc_sd_switch_hs(device, type, status))
+        return 0;
+
+    /* Reconfigure the internal clock. */
+    if (!sdmmc_select_speed(device->sdmmc, bus_speed))
+        return 0;
+
+    /* Only SDR50 and up need tuning. */
+    if ((bus_speed == SDMMC_SPEED_SD_SDR50) && !sdmmc_execute_tuning(device->sdmmc, bus_speed, MMC_SEND_TUNING_BLOCK))
+        return 0;
+
+    device->bus_speed = bus_speed;
+
+    /* Correct any inconsistent states. */
+    sdmmc_adjust_sd_clock(device->sdmmc);
+
+    /* Peek the SD card's status. */
+    return sdmmc_device_send_status(device);
+}
+
 static int sdmmc_sd_status(sdmmc_device_t *device, uint8_t *ssr)
 {
     sdmmc_command_t cmd = {};
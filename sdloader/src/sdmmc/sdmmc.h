@@ -154,11 +154,21 @@ typedef struct  {
     uint8_t     app_perf_class;
 } sd_ssr_t;
 
+/* Transfer errors seen by sdmmc_device_read/write, for the diagnostic log. */
+typedef struct {
+    uint32_t retries;
+    uint32_t crc_errors;
+    uint32_t timeouts;
+    uint32_t speed_downgrades;
+} sdmmc_device_stats_t;
+
 /* Structure describing a SDMMC device's context. */
 typedef struct {
     /* Underlying driver context. */
     sdmmc_t *sdmmc;
     
+    SdmmcBusSpeed bus_speed;    /* Only tracked for SD UHS modes. */
+    sdmmc_device_stats_t stats;
     bool is_180v;
     bool is_block_sdhc;
     uint32_t rca;
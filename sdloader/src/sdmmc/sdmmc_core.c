@@ -40,7 +40,7 @@ static bool is_soc_mariko() {
 #if 0
 static void sdmmc_print(sdmmc_t *sdmmc, ScreenLogLevel screen_log_level, char *fmt, va_list list)
 {
-    if (screen_log_level > log_get_log_level())
+    if (!log_is_captured(screen_log_level))
         return;
     
     print(screen_log_level, "%s: ", sdmmc->name);
@@ -1399,6 +1399,8 @@ static int sdmmc_intr_check(sdmmc_t *sdmmc, uint16_t *status_out, uint16_t statu
     
     if (int_status & TEGRA_MMC_NORINTSTS_ERR_INTERRUPT)
     {
+        sdmmc->last_error = int_status;
+
         /* Acknowledge error by refreshing status. */
         sdmmc->regs->int_status = int_status;
         return -1;
@@ -1484,7 +1486,7 @@ static int sdmmc_dma_init(sdmmc_t *sdmmc, sdmmc_request_t *req)
     return blkcnt;
 }
 
-static int sdmmc_dma_update(sdmmc_t *sdmmc)
+static int sdmmc_dma_update(sdmmc_t *sdmmc, uint32_t *blocks_left)
 {
     uint16_t blkcnt = 0;
     
@@ -1508,6 +1510,7 @@ static int sdmmc_dma_update(sdmmc_t *sdmmc)
             /* An error has been raised. Reset. */
             if (intr_res < 0)
             {
+                *blocks_left = sdmmc->regs->block_count;
                 sdmmc_do_sw_reset(sdmmc);
                 return 0;
             }
@@ -1535,11 +1538,12 @@ static int sdmmc_dma_update(sdmmc_t *sdmmc)
             }
             
             /* Keep checking if timeout expired. */
-            is_timeout = (get_time_since(timebase) > 2000000);            
+            is_timeout = (get_time_since(timebase) > SDMMC_DMA_TIMEOUT);
         }
     } while (sdmmc->regs->block_count < blkcnt);
     
     /* Should never get here. Reset. */
+    *blocks_left = sdmmc->regs->block_count;
     sdmmc_do_sw_reset(sdmmc);
     return 0;
 }
@@ -1674,6 +1678,8 @@ int sdmmc_send_cmd(sdmmc_t *sdmmc, sdmmc_command_t *cmd, sdmmc_request_t *req, u
 {
     uint32_t cmd_result = 0;
     bool shutdown_sd_clock = false;
+
+    sdmmc->last_error = 0;
         
     /* Run automatic calibration on each command submission for SDMMC1 (Erista only). */
     if ((sdmmc->controller == SDMMC_1) && !(sdmmc->has_sd) && !(is_soc_mariko()))
@@ -1740,10 +1746,15 @@ int sdmmc_send_cmd(sdmmc_t *sdmmc, sdmmc_command_t *cmd, sdmmc_request_t *req, u
         if (req)
         {
             /* Disable interrupts and abort in case updating failed. */
-            if (!sdmmc_dma_update(sdmmc))
+            uint32_t blocks_left = dma_blkcnt;
+            if (!sdmmc_dma_update(sdmmc, &blocks_left))
             {
                 //sdmmc_warn(sdmmc, "Failed to update the DMA transfer!");
                 sdmmc_intr_disable(sdmmc);
+
+                /* Tell how far it got, SDMA blocks are still stuck in the bounce buffer. */
+                if (num_blocks_out && sdmmc->use_adma && blocks_left <= dma_blkcnt)
+                    *num_blocks_out = dma_blkcnt - blocks_left;
                 return 0;
             }
             
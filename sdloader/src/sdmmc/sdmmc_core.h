@@ -145,6 +145,7 @@
 /* Timeouts */
 #define SDMMC_AUTOCAL_TIMEOUT                           (10 * 1000)
 #define SDMMC_TUNING_TIMEOUT                            (150 * 1000)
+#define SDMMC_DMA_TIMEOUT                               (500 * 1000)    /* Without progress. The SD spec's worst case (SDXC write busy) is 500ms. */
 
 /* Command response flags */
 #define SDMMC_RSP_PRESENT                               (1 << 0)
@@ -266,6 +267,7 @@ typedef struct {
     uint32_t resp_auto_cmd12;
     uint32_t next_dma_addr;
     uint8_t* dma_bounce_buf;
+    uint32_t last_error;    /* Interrupt status of the last error raised by sdmmc_send_cmd. */
     SdmmcBusVoltage bus_voltage;
     SdmmcBusWidth bus_width;
     
@@ -300,6 +302,7 @@ void sdmmc_adjust_sd_clock(sdmmc_t *sdmmc);
 int sdmmc_switch_voltage(sdmmc_t *sdmmc);
 void sdmmc_set_tuning_tap_val(sdmmc_t *sdmmc);
 int sdmmc_execute_tuning(sdmmc_t *sdmmc, SdmmcBusSpeed bus_speed, uint32_t opcode);
+/* On a failed data transfer, num_blocks_out is what the controller counted as transferred (ADMA only). */
 int sdmmc_send_cmd(sdmmc_t *sdmmc, sdmmc_command_t *cmd, sdmmc_request_t *req, uint32_t *num_blocks_out);
 int sdmmc_load_response(sdmmc_t *sdmmc, uint32_t flags, uint32_t *resp);
 int sdmmc_abort(sdmmc_t *sdmmc, uint32_t opcode);
@@ -70,6 +70,9 @@
 #define TEGRA_MMC_NORINTSTS_DMA_INTERRUPT                       (1 << 3)
 #define TEGRA_MMC_NORINTSTS_ERR_INTERRUPT                       (1 << 15)
 #define TEGRA_MMC_NORINTSTS_CMD_TIMEOUT                         (1 << 16)
+#define TEGRA_MMC_NORINTSTS_CMD_CRC_ERR                         (1 << 17)
+#define TEGRA_MMC_NORINTSTS_DATA_TIMEOUT                        (1 << 20)
+#define TEGRA_MMC_NORINTSTS_DATA_CRC_ERR                        (1 << 21)
 
 #define TEGRA_MMC_NORINTSTSEN_CMD_COMPLETE                      (1 << 0)
 #define TEGRA_MMC_NORINTSTSEN_XFER_COMPLETE                     (1 << 1)
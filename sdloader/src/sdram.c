@@ -21,6 +21,13 @@ void sdram_init_t214();
 
 void sdram_init()
 {
+    static bool trained;
+
+    /* Training twice would reset DRAM under whatever lives there by now. */
+    if (trained)
+        return;
+    trained = true;
+
     if (is_mariko())
         sdram_init_t214();
     else
@@ -15,7 +15,7 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
  
-static const uint8_t _dram_cfg_lz_t210[1262] = {
+static const uint8_t _dram_cfg_lz_t210[1395] = {
     0x17, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00,
     0x00, 0x2C, 0x17, 0x04, 0x09, 0x00, 0x17, 0x04, 0x04, 0x17, 0x08, 0x08,
     0x17, 0x10, 0x10, 0x00, 0x00, 0x68, 0xBC, 0x01, 0x70, 0x0A, 0x00, 0x00,
@@ -105,21 +105,43 @@ static const uint8_t _dram_cfg_lz_t210[1262] = {
     0x38, 0x1E, 0x17, 0x0A, 0x38, 0x17, 0x13, 0x81, 0x28, 0x00, 0xC0, 0x17,
     0x17, 0x55, 0x46, 0x24, 0x17, 0x0A, 0x81, 0x28, 0x17, 0x14, 0x38, 0x17,
     0x18, 0x81, 0x60, 0x46, 0x2C, 0x17, 0x06, 0x38, 0xEC, 0x17, 0x0D, 0x16,
-    0x17, 0x0E, 0x82, 0x3C, 0x17, 0x82, 0x0C, 0x8E, 0x68, 0x17, 0x04, 0x24,
-    0x17, 0x5C, 0x8E, 0x68, 0x17, 0x07, 0x82, 0x5F, 0x80, 0x17, 0x87, 0x01,
-    0x8E, 0x68, 0x02, 0x17, 0x81, 0x4A, 0x8E, 0x68, 0x17, 0x0C, 0x87, 0x78,
-    0x17, 0x85, 0x28, 0x8E, 0x68, 0x17, 0x8E, 0x68, 0x9D, 0x50, 0x17, 0x81,
-    0x24, 0x8E, 0x68, 0x17, 0x04, 0x2C, 0x17, 0x28, 0x8E, 0x68, 0x17, 0x04,
-    0x30, 0x17, 0x85, 0x3C, 0x8E, 0x68, 0x12, 0x17, 0x07, 0x85, 0x70, 0x17,
-    0x88, 0x74, 0x8E, 0x68, 0x17, 0x87, 0x3E, 0x9D, 0x50, 0x0C, 0x17, 0x04,
-    0x04, 0x17, 0x12, 0x8E, 0x68, 0x18, 0x17, 0x87, 0x12, 0xBB, 0x20, 0x17,
-    0x83, 0x04, 0x9D, 0x50, 0x15, 0x17, 0x05, 0x8D, 0x76, 0x17, 0x0F, 0x8B,
+    0x17, 0x0E, 0x82, 0x3C, 0x17, 0x17, 0x82, 0x0C, 0x8E, 0x68, 0x17, 0x04,
+    0x24, 0x17, 0x5C, 0x8E, 0x68, 0x17, 0x07, 0x82, 0x5F, 0x80, 0x17, 0x87,
+    0x01, 0x8E, 0x68, 0x02, 0x17, 0x81, 0x4A, 0x8E, 0x68, 0x17, 0x0C, 0x87,
+    0x78, 0x17, 0x83, 0x1C, 0x8E, 0x68, 0x17, 0x17, 0x8E, 0x68, 0x8E, 0x68,
+    0x17, 0x17, 0x83, 0x30, 0x8E, 0x68, 0x17, 0x04, 0x2C, 0x17, 0x28, 0x8E,
+    0x68, 0x17, 0x04, 0x30, 0x17, 0x85, 0x3C, 0x8E, 0x68, 0x12, 0x17, 0x07,
+    0x85, 0x70, 0x17, 0x85, 0x44, 0x8E, 0x68, 0x17, 0x17, 0x8A, 0x6E, 0x8E,
+    0x68, 0x0C, 0x17, 0x04, 0x04, 0x17, 0x12, 0x8E, 0x68, 0x18, 0x17, 0x83,
+    0x62, 0x8E, 0x68, 0x17, 0x17, 0x82, 0x0C, 0x8E, 0x68, 0x17, 0x04, 0x24,
+    0x17, 0x5C, 0x8E, 0x68, 0x17, 0x07, 0x82, 0x5F, 0x80, 0x17, 0x3C, 0x8E,
+    0x68, 0x17, 0x04, 0x2C, 0x17, 0x28, 0x8E, 0x68, 0x17, 0x04, 0x30, 0x17,
+    0x82, 0x54, 0x8E, 0x68, 0x15, 0x17, 0x05, 0x8D, 0x76, 0x17, 0x0F, 0x8B,
     0x49, 0x17, 0x0B, 0x18, 0x32, 0x00, 0x2F, 0x00, 0x32, 0x00, 0x31, 0x00,
     0x34, 0x00, 0x36, 0x00, 0x2F, 0x00, 0x33, 0x17, 0x09, 0x84, 0x0C, 0x17,
     0x18, 0x18, 0x17, 0x20, 0x8E, 0x68, 0x15, 0x17, 0x07, 0x5A, 0x17, 0x06,
-    0x5E, 0x16, 0x00, 0x15, 0x17, 0x82, 0x40, 0x9D, 0x50, 0x17, 0x86, 0x5F,
-    0xBB, 0x20, 0x3A, 0x00, 0x00, 0x00, 0x1D, 0x17, 0x81, 0x4F, 0xAC, 0x38,
-    0x3B, 0x17, 0x04, 0x04, 0x17, 0x86, 0x30, 0x8E, 0x68, 0x17, 0x81, 0x53,
-    0xAC, 0x38, 0x07, 0x17, 0x0D, 0x8E, 0x68, 0xA3, 0x72, 0x17, 0x83, 0x10,
-    0x8E, 0x68
+    0x5E, 0x16, 0x00, 0x15, 0x17, 0x81, 0x67, 0x8E, 0x68, 0x12, 0x17, 0x07,
+    0x85, 0x70, 0x17, 0x51, 0x8E, 0x68, 0x02, 0x17, 0x81, 0x4A, 0x8E, 0x68,
+    0x17, 0x0C, 0x87, 0x78, 0x17, 0x83, 0x1C, 0x8E, 0x68, 0x17, 0x17, 0x81,
+    0x6C, 0x8E, 0x68, 0x3A, 0x00, 0x00, 0x00, 0x1D, 0x17, 0x81, 0x3F, 0x8E,
+    0x68, 0x17, 0x04, 0x2C, 0x17, 0x0C, 0x8E, 0x68, 0x3B, 0x17, 0x04, 0x04,
+    0x17, 0x17, 0x8E, 0x68, 0x17, 0x04, 0x30, 0x17, 0x82, 0x54, 0x8E, 0x68,
+    0x15, 0x17, 0x05, 0x8D, 0x76, 0x17, 0x0F, 0x8B, 0x49, 0x17, 0x0B, 0x18,
+    0x32, 0x00, 0x2F, 0x00, 0x32, 0x00, 0x31, 0x00, 0x34, 0x00, 0x36, 0x00,
+    0x2F, 0x00, 0x33, 0x17, 0x09, 0x84, 0x0C, 0x17, 0x18, 0x18, 0x17, 0x20,
+    0x8E, 0x68, 0x15, 0x17, 0x07, 0x5A, 0x17, 0x06, 0x5E, 0x16, 0x00, 0x15,
+    0x17, 0x81, 0x67, 0x8E, 0x68, 0x12, 0x17, 0x07, 0x85, 0x70, 0x17, 0x82,
+    0x24, 0x8E, 0x68, 0x07, 0x17, 0x0D, 0x8E, 0x68, 0xA3, 0x72, 0x17, 0x83,
+    0x10, 0x8E, 0x68
+};
+
+/* { offset, size } of the compressed config for each DRAM ID. All but the first use config 0 as dictionary. */
+static const uint16_t _dram_cfg_lz_t210_index[7][2] = {
+    { 0, 1072 },
+    { 1072, 38 },
+    { 1110, 6 },
+    { 1116, 31 },
+    { 1147, 20 },
+    { 1167, 114 },
+    { 1281, 114 }
 };
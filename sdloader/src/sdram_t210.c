@@ -540,8 +540,15 @@ static const void *sdram_get_params()
 
 #ifdef CONFIG_SDRAM_COMPRESS_CFG
     uint8_t *buf = (uint8_t *)0x40030000;
-    LZ_Uncompress(_dram_cfg_lz_t210, buf, sizeof(_dram_cfg_lz_t210));
-    return (const void *)&buf[sizeof(sdram_params_t) * fuse_get_dram_id()];
+    uint32_t id = fuse_get_dram_id();
+
+    /* Config 0 is standalone, all others are compressed against it. */
+    LZ_Uncompress(&_dram_cfg_lz_t210[_dram_cfg_lz_t210_index[0][0]], buf, _dram_cfg_lz_t210_index[0][1]);
+    if (id == 0)
+        return (const void *)buf;
+
+    LZ_UncompressDict(&_dram_cfg_lz_t210[_dram_cfg_lz_t210_index[id][0]], buf, _dram_cfg_lz_t210_index[id][1], sizeof(sdram_params_t));
+    return (const void *)&buf[sizeof(sdram_params_t)];
 #else
     return _dram_cfgs_t210[fuse_get_dram_id()];
 #endif
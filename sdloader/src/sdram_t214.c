@@ -559,8 +559,15 @@ static const void *sdram_get_params()
 {
 #ifdef CONFIG_SDRAM_COMPRESS_CFG
     uint8_t *buf = (uint8_t *)0x40030000;
-    LZ_Uncompress(_dram_cfg_lz_t214, buf, sizeof(_dram_cfg_lz_t214));
-    return (const void *)&buf[sizeof(sdram_params_t) * dram_mappers[fuse_get_dram_id() - 7]];
+    uint32_t id = dram_mappers[fuse_get_dram_id() - 7];
+
+    /* Config 0 is standalone, all others are compressed against it. */
+    LZ_Uncompress(&_dram_cfg_lz_t214[_dram_cfg_lz_t214_index[0][0]], buf, _dram_cfg_lz_t214_index[0][1]);
+    if (id == 0)
+        return (const void *)buf;
+
+    LZ_UncompressDict(&_dram_cfg_lz_t214[_dram_cfg_lz_t214_index[id][0]], buf, _dram_cfg_lz_t214_index[id][1], sizeof(sdram_params_t));
+    return (const void *)&buf[sizeof(sdram_params_t)];
 #else
     return _dram_cfgs_t214[dram_mappers[fuse_get_dram_id() - 7]];
 #endif
@@ -192,6 +192,13 @@ void se_get_exp_mod_output(void *buf, size_t size) {
 }
 
 bool se_rsa2048_pss_verify(const void *signature, size_t signature_size, const void *modulus, size_t modulus_size, const void *data, size_t data_size) {
+    uint8_t hash[0x20];
+
+    se_calculate_sha256(hash, data, data_size);
+    return se_rsa2048_pss_verify_hash(signature, signature_size, modulus, modulus_size, hash);
+}
+
+bool se_rsa2048_pss_verify_hash(const void *signature, size_t signature_size, const void *modulus, size_t modulus_size, const void *hash) {
     uint8_t message[RSA_2048_BYTES];
     uint8_t h_buf[0x24];
 
@@ -238,32 +245,43 @@ bool se_rsa2048_pss_verify(const void *signature, size_t signature_size, const v
     uint8_t validate_hash[0x20];
 
     memset(validate_buf, 0, sizeof(validate_buf));
-    se_calculate_sha256(&validate_buf[8], data, data_size);
+    memcpy(&validate_buf[8], hash, 0x20);
     memcpy(&validate_buf[0x28], &message[RSA_2048_BYTES - 0x20 - 0x20 - 1], 0x20);
     se_calculate_sha256(validate_hash, validate_buf, sizeof(validate_buf));
     return memcmp(h_buf, validate_hash, 0x20) == 0;
 }
 
-void trigger_se_blocking_op(unsigned int op, void *dst, size_t dst_size, const void *src, size_t src_size) {
+/* The LLs must outlive the call for asynchronous operations. */
+static se_ll_t g_se_in_ll;
+static se_ll_t g_se_out_ll;
+
+void trigger_se_async_op(unsigned int op, void *dst, size_t dst_size, const void *src, size_t src_size) {
     volatile tegra_se_t *se = se_get_regs();
-    se_ll_t in_ll;
-    se_ll_t out_ll;
 
-    ll_init(&in_ll, (void *)src, src_size);
-    ll_init(&out_ll, dst, dst_size);
+    ll_init(&g_se_in_ll, (void *)src, src_size);
+    ll_init(&g_se_out_ll, dst, dst_size);
 
     /* Set the LLs. */
-    se->SE_IN_LL_ADDR = (uint32_t) get_physical_address(&in_ll);
-    se->SE_OUT_LL_ADDR = (uint32_t) get_physical_address(&out_ll);
+    se->SE_IN_LL_ADDR = (uint32_t) get_physical_address(&g_se_in_ll);
+    se->SE_OUT_LL_ADDR = (uint32_t) get_physical_address(&g_se_out_ll);
 
     /* Set registers for operation. */
     se->SE_ERR_STATUS = se->SE_ERR_STATUS;
     se->SE_INT_STATUS = se->SE_INT_STATUS;
     se->SE_OPERATION = op;
+}
+
+void se_wait_async_op(void) {
+    volatile tegra_se_t *se = se_get_regs();
 
     while (!(se->SE_INT_STATUS & 0x10)) { /* Wait a while */ }
 }
 
+void trigger_se_blocking_op(unsigned int op, void *dst, size_t dst_size, const void *src, size_t src_size) {
+    trigger_se_async_op(op, dst, dst_size, src, src_size);
+    se_wait_async_op();
+}
+
 /* Secure AES Functionality. */
 void se_perform_aes_block_operation(void *dst, size_t dst_size, const void *src, size_t src_size) {
     uint8_t block[0x10] = {0};
@@ -503,25 +521,45 @@ void se_aes_256_cbc_encrypt(unsigned int keyslot, void *dst, size_t dst_size, co
 }
 
 /* SHA256 Implementation. */
-void se_calculate_sha256(void *dst, const void *src, size_t src_size) {
+/* Setup config for SHA256. The SE pads once size_left runs out, using total_size as message length. */
+static void se_sha256_configure(bool restart, size_t total_size, size_t size_left) {
     volatile tegra_se_t *se = se_get_regs();
-    
-    /* Setup config for SHA256, size = BITS(src_size) */
+
     se->SE_CONFIG = (ENC_MODE_SHA256 | ENC_ALG_SHA | DST_HASHREG);
-    se->SE_SHA_CONFIG = 1;
-    se->SE_SHA_MSG_LENGTH[0] = (uint32_t)(src_size << 3);
+    se->SE_SHA_CONFIG = restart ? 1 : 0;
+    se->SE_SHA_MSG_LENGTH[0] = (uint32_t)(total_size << 3);
     se->SE_SHA_MSG_LENGTH[1] = 0;
     se->SE_SHA_MSG_LENGTH[2] = 0;
     se->SE_SHA_MSG_LENGTH[3] = 0;
-    se->SE_SHA_MSG_LEFT[0] = (uint32_t)(src_size << 3);
+    se->SE_SHA_MSG_LEFT[0] = (uint32_t)(size_left << 3);
     se->SE_SHA_MSG_LEFT[1] = 0;
     se->SE_SHA_MSG_LEFT[2] = 0;
     se->SE_SHA_MSG_LEFT[3] = 0;
+}
+
+void se_calculate_sha256(void *dst, const void *src, size_t src_size) {
+    /* size = BITS(src_size) */
+    se_sha256_configure(true, src_size, src_size);
 
     /* Trigger the operation. */
     trigger_se_blocking_op(OP_START, NULL, 0, src, src_size);
 
     /* Copy output hash. */
+    se_sha256_get_result(dst);
+}
+
+/* Hash one chunk of a larger message. All chunks but the last must be a multiple of 0x40 bytes. */
+/* The intermediate state stays in SE_HASH_RESULT, so the SE must not be used for anything else until the last chunk. */
+void se_sha256_chunk_start(const void *src, size_t src_size, size_t total_size, size_t size_left) {
+    se_sha256_configure(size_left == total_size, total_size, size_left);
+
+    /* Kick off the operation, the caller waits with se_wait_async_op(). */
+    trigger_se_async_op(OP_START, NULL, 0, src, src_size);
+}
+
+void se_sha256_get_result(void *dst) {
+    volatile tegra_se_t *se = se_get_regs();
+
     for (unsigned int i = 0; i < (0x20 >> 2); i++) {
         ((uint32_t *)dst)[i] = read32be(se->SE_HASH_RESULT, i << 2);
     }
@@ -210,6 +210,8 @@ static inline volatile tegra_se_t *se_get_regs(void) {
 
 void NOINLINE ll_init(volatile se_ll_t *ll, void *buffer, size_t size);
 void trigger_se_blocking_op(unsigned int op, void *dst, size_t dst_size, const void *src, size_t src_size);
+void trigger_se_async_op(unsigned int op, void *dst, size_t dst_size, const void *src, size_t src_size);
+void se_wait_async_op(void);
 
 void se_check_error_status_reg(void);
 void se_check_for_error(void);
@@ -232,8 +234,8 @@ void set_aes_keyslot_iv(unsigned int keyslot, const void *iv, size_t iv_size);
 void set_se_ctr(const void *ctr);
 
 /* Secure AES API */
-void se_aes_128_xts_nintendo_decrypt(unsigned int keyslot_1, unsigned int keyslot_2, unsigned int base_sector, void *dst, const void *src, size_t size, unsigned int sector_size);
-void se_aes_128_xts_nintendo_encrypt(unsigned int keyslot_1, unsigned int keyslot_2, unsigned int base_sector, void *dst, const void *src, size_t size, unsigned int sector_size);
+void se_aes_128_xts_nintendo_decrypt(unsigned int keyslot_1, unsigned int keyslot_2, size_t base_sector, void *dst, const void *src, size_t size, unsigned int sector_size);
+void se_aes_128_xts_nintendo_encrypt(unsigned int keyslot_1, unsigned int keyslot_2, size_t base_sector, void *dst, const void *src, size_t size, unsigned int sector_size);
 void se_compute_aes_128_cmac(unsigned int keyslot, void *cmac, size_t cmac_size, const void *data, size_t data_size);
 void se_compute_aes_256_cmac(unsigned int keyslot, void *cmac, size_t cmac_size, const void *data, size_t data_size);
 void se_aes_128_ecb_encrypt_block(unsigned int keyslot, void *dst, size_t dst_size, const void *src, size_t src_size);
@@ -246,11 +248,14 @@ void se_aes_256_cbc_encrypt(unsigned int keyslot, void *dst, size_t dst_size, co
 
 /* Hash API */
 void se_calculate_sha256(void *dst, const void *src, size_t src_size);
+void se_sha256_chunk_start(const void *src, size_t src_size, size_t total_size, size_t size_left);
+void se_sha256_get_result(void *dst);
 
 /* RSA API */
 void se_get_exp_mod_output(void *buf, size_t size);
 void se_synchronous_exp_mod(unsigned int keyslot, void *dst, size_t dst_size, const void *src, size_t src_size);
 bool se_rsa2048_pss_verify(const void *signature, size_t signature_size, const void *modulus, size_t modulus_size, const void *data, size_t data_size);
+bool se_rsa2048_pss_verify_hash(const void *signature, size_t signature_size, const void *modulus, size_t modulus_size, const void *hash);
 
 /* RNG API */
 void se_initialize_rng(unsigned int keyslot);
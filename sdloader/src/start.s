@@ -68,5 +68,6 @@ _start:
 .global relocate_and_chainload
 .type   relocate_and_chainload, %function
 relocate_and_chainload:
-    ldr sp, =__stack_top__
+    /* Below the payload, which may be copied over our regular stack top */
+    ldr sp, =__chainloader_stack_top__
     b   relocate_and_chainload_main
@@ -32,6 +32,7 @@
 #include "max77620.h"
 #include "fuse.h"
 #include "fs_utils.h"
+#include "sdram.h"
 
 #include <inttypes.h>
 
@@ -68,6 +69,7 @@ __attribute__((noreturn)) void watchdog_reboot(void) {
         /* Wait for reboot. */
     }
 }
+#endif
 
 __attribute__((noreturn)) void pmc_reboot(uint32_t scratch0) {
     APBDEV_PMC_SCRATCH0_0 = scratch0;
@@ -90,25 +92,27 @@ __attribute__((noreturn)) void wait_for_button_and_reboot(void) {
     }
 }
 
-__attribute__((noreturn)) void fatal_error(const char *fmt, ...) {
-    /* Forcefully initialize the screen if logging is disabled. */
-    if (log_get_log_level() == SCREEN_LOG_LEVEL_NONE) {
-        /* Zero-fill the framebuffer and register it as printk provider. */
-        video_init((void *)0xC0000000);
+void console_init(void) {
+    /* The console lives in DRAM, which boots that never need it don't train. */
+    sdram_init();
 
-        /* Initialize the display. */
-        display_init();
+    /* Zero-fill the framebuffer and register it as printk provider. */
+    video_init((void *)0xC0000000);
 
-        /* Set the framebuffer. */
-        display_init_framebuffer((void *)0xC0000000);
+    /* Initialize the display. */
+    display_init();
 
-        /* Turn on the backlight after initializing the lfb */
-        /* to avoid flickering. */
-        display_backlight(true);
-    }
-    
-    /* Override the global logging level. */
-    log_set_log_level(SCREEN_LOG_LEVEL_ERROR);
+    /* Set the framebuffer. */
+    display_init_framebuffer((void *)0xC0000000);
+
+    /* Turn on the backlight after initializing the lfb */
+    /* to avoid flickering. */
+    display_backlight(true);
+}
+
+__attribute__((noreturn)) void fatal_error(const char *fmt, ...) {
+    /* Show what was logged so far, the console comes up if it isn't already. */
+    log_flush_to_screen();
     
     /* Display fatal error. */
     va_list args;
@@ -122,6 +126,7 @@ __attribute__((noreturn)) void fatal_error(const char *fmt, ...) {
     wait_for_button_and_reboot();
 }
 
+#if 0
 __attribute__((noinline)) bool overlaps(uint64_t as, uint64_t ae, uint64_t bs, uint64_t be)
 {
     if(as <= bs && bs <= ae)
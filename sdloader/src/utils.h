@@ -137,7 +137,8 @@ static inline bool check_32bit_address_range_in_program(uintptr_t addr, size_t s
 
     return overlaps_a(start, end, __chainloader_start__, __chainloader_end__) ||
     overlaps_a(start, end, __stack_bottom__, __stack_top__) ||
-    overlaps_a(start, end, (void *)0xC0000000, (void *)0xC03C0000) || /* framebuffer */
+    overlaps_a(start, end, (void *)0xC0000000, (void *)0xC0780000) || /* framebuffer, console ring is two screens */
+    overlaps_a(start, end, (void *)0xF0000000, (void *)0xF0030000) || /* large payload staging */
     overlaps_a(start, end, __start__, __end__);
 }
 
@@ -145,6 +146,8 @@ __attribute__((noreturn)) void watchdog_reboot(void);
 __attribute__((noreturn)) void pmc_reboot(uint32_t scratch0);
 __attribute__((noreturn)) void wait_for_button_and_reboot(void);
 
+/* Trains DRAM if needed and shows the full resolution console at 0xC0000000. */
+void console_init(void);
 __attribute__((noreturn)) void fatal_error(const char *fmt, ...);
 __attribute__((noreturn)) void power_off(void);
 __attribute__((noreturn)) void power_off_reset(void);